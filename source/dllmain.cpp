@@ -26,16 +26,28 @@ void WaitForDebugger() {
 
 static constexpr auto DEFAULT_INI_FILENAME = "gta-reversed.ini";
 
+#include "extensions/Configs/Animation.hpp"
+#include "extensions/Configs/Collision.hpp"
 #include "extensions/Configs/FastLoader.hpp"
 #include "extensions/Configs/Miscellaneous.hpp"
+#include "extensions/Configs/Pools.hpp"
+#include "extensions/Configs/Scripts.hpp"
+#include "extensions/Configs/Streaming.hpp"
+#include "extensions/Configs/World.hpp"
 
 void LoadConfigurations() {
     // Firstly load the INI into the memory.
     g_ConfigurationMgr.Load(DEFAULT_INI_FILENAME);
 
     // Then load all specific configurations.
+    g_AnimationConfig.Load();
+    g_CollisionConfig.Load();
     g_FastLoaderConfig.Load();
     g_MiscConfig.Load();
+    g_PoolsConfig.Load();
+    g_ScriptsConfig.Load();
+    g_StreamingConfig.Load();
+    g_WorldConfig.Load();
     // ...
 }
 
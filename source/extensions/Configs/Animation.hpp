@@ -0,0 +1,29 @@
+#pragma once
+#include "app_debug.h"
+
+#include "extensions/Configuration.hpp"
+
+inline struct AnimationConfig {
+    INI_CONFIG_SECTION("Animation");
+
+    //! Interpolate the key-frames of all frames of a clump at once, using SIMD (See `notsa::AnimBlendFrameBatch`)
+    bool BatchedFrameUpdate         = false;
+    bool ValidateBatchedFrameUpdate = false; //< Also interpolate the original way, and compare the results (See `notsa::AnimBlendFrameBatch::Stats`)
+
+    //! Evaluate less bones of the peds that are small on screen (See `notsa::AnimLOD`)
+    bool   AnimLOD             = false;
+    float  AnimLODFullDistance = 10.f;  //< [Units] Peds closer than this are always in full detail
+    float  AnimLODReducedSize  = 0.25f; //< [Screen height fraction] Peds smaller than this on screen only have their main bones evaluated
+    float  AnimLODLowSize      = 0.08f; //< [Screen height fraction] Peds smaller than this are also only evaluated every `AnimLODLowRate`th frame
+    uint32 AnimLODLowRate      = 4u;
+
+    void Load() {
+        STORE_INI_CONFIG_VALUE(BatchedFrameUpdate, false);
+        STORE_INI_CONFIG_VALUE(ValidateBatchedFrameUpdate, false);
+        STORE_INI_CONFIG_VALUE(AnimLOD, false);
+        STORE_INI_CONFIG_VALUE(AnimLODFullDistance, 10.f);
+        STORE_INI_CONFIG_VALUE(AnimLODReducedSize, 0.25f);
+        STORE_INI_CONFIG_VALUE(AnimLODLowSize, 0.08f);
+        STORE_INI_CONFIG_VALUE(AnimLODLowRate, 4u);
+    }
+} g_AnimationConfig{};
@@ -0,0 +1,33 @@
+#pragma once
+#include "app_debug.h"
+
+#include "extensions/Configuration.hpp"
+
+inline struct CollisionConfig {
+    INI_CONFIG_SECTION("Collision");
+
+    //! Build a tree of the triangles of col models when they're loaded (See `notsa::ColTriangleBVH`), and use it for line of sight and sphere cast tests
+    bool   TriangleBVH             = true;
+    uint32 TriangleBVHMinTriangles = 64; //< Col models with fewer triangles than this are still brute-forced
+
+    //! Test the triangles of the tree's leaves with SSE first, and only process the ones that may be hit (See `notsa::ColTrianglePack`)
+    bool TriangleSIMD         = true;
+    bool ValidateTriangleSIMD = false; //< Process all triangles anyways, and log the ones that were hit but culled by SSE (Should never happen)
+
+    //! Reuse the contacts found between 2 entities while they barely move relative to each other (See `notsa::ContactCache`)
+    bool   ContactCache          = false;
+    float  ContactCacheMaxMove   = 0.05f; //< [Units] How far an entity may move relative to the other before its contacts are found again
+    float  ContactCacheMaxTurn   = 0.02f; //< [~Radians] Same, but for turning
+    uint32 ContactCacheMaxFrames = 8;     //< Contacts are found again after this many frames anyways
+
+    void Load() {
+        STORE_INI_CONFIG_VALUE(TriangleBVH, true);
+        STORE_INI_CONFIG_VALUE(TriangleBVHMinTriangles, 64u);
+        STORE_INI_CONFIG_VALUE(TriangleSIMD, true);
+        STORE_INI_CONFIG_VALUE(ValidateTriangleSIMD, false);
+        STORE_INI_CONFIG_VALUE(ContactCache, false);
+        STORE_INI_CONFIG_VALUE(ContactCacheMaxMove, 0.05f);
+        STORE_INI_CONFIG_VALUE(ContactCacheMaxTurn, 0.02f);
+        STORE_INI_CONFIG_VALUE(ContactCacheMaxFrames, 8u);
+    }
+} g_CollisionConfig{};
@@ -0,0 +1,31 @@
+#pragma once
+#include "app_debug.h"
+
+#include "extensions/Configuration.hpp"
+
+inline struct PoolsConfig {
+    INI_CONFIG_SECTION("Pools");
+
+    //! Pools whose every allocation/deallocation goes through a locked hook (See `CPools::Initialise`) may use these:
+    bool UseFreeList    = false; //< Use a free-list for allocating from the pools (instead of scanning for a free slot)
+    bool TrackOccupancy = false; //< Keep an occupancy bitmap for the pools (Iteration skips free slots in bulk)
+
+    //! Allocate the events that are deleted right after being cloned from an arena, instead of the event pool (See `notsa::EventArena`)
+    bool TransientEventArena = false;
+
+    //! Max. capacity of growable pools - The pool grows in chunks of a quarter of its vanilla capacity once full.
+    //! `0` (or anything below the vanilla capacity) disables growing, which is the default.
+    //! Only the pools that are safe to grow are here (See `CPool::SetGrowable`):
+    //! Their objects have no refs, and unhooked code only allocates/frees them through hooked functions.
+    size_t MaxEntryInfoNodes{}; //< `CEntryInfoNode::operator new/delete` (0x536DC0, 0x536DD0)
+    size_t MaxEvents{};         //< `CEvent::operator new/delete` (0x4B5620, 0x4B5630)
+
+    void Load() {
+        STORE_INI_CONFIG_VALUE(UseFreeList, false);
+        STORE_INI_CONFIG_VALUE(TrackOccupancy, false);
+        STORE_INI_CONFIG_VALUE(TransientEventArena, false);
+
+        STORE_INI_CONFIG_VALUE(MaxEntryInfoNodes, 0u);
+        STORE_INI_CONFIG_VALUE(MaxEvents, 0u);
+    }
+} g_PoolsConfig{};
@@ -0,0 +1,15 @@
+#pragma once
+#include "app_debug.h"
+
+#include "extensions/Configuration.hpp"
+
+inline struct ScriptsConfig {
+    INI_CONFIG_SECTION("Scripts");
+
+    //! Resolve the handlers of the instructions in the script space only once (See `notsa::script::DecodeCache`)
+    bool DecodeCache = false;
+
+    void Load() {
+        STORE_INI_CONFIG_VALUE(DecodeCache, false);
+    }
+} g_ScriptsConfig{};
@@ -0,0 +1,54 @@
+#pragma once
+#include "app_debug.h"
+
+#include "extensions/Configuration.hpp"
+
+inline struct StreamingConfig {
+    INI_CONFIG_SECTION("Streaming");
+
+    //! Load requested models using `notsa::CdStreamAsyncReader` in `CStreaming::LoadAllRequestedModels` (Many reads in flight, instead of the 2 channels)
+    bool   AsyncReader            = true;
+    uint32 AsyncReaderThreads     = 4;         //< Number of reader threads
+    uint32 AsyncReaderMaxReadKiB  = 1024;      //< Adjacent models are coalesced into reads of at most this size
+    uint32 AsyncReaderMaxBatchKiB = 32 * 1024; //< Max. amount of data read at once (Models bigger than this are still read, but alone)
+
+    //! Pick the next model to read by how urgently it's needed (See `notsa::StreamingScheduler`), instead of by disk position only
+    bool   Scheduler                 = true;
+    uint32 SchedulerDeadlineMs       = 1000; //< Requests are expected to be loaded within this time
+    uint32 SchedulerLocalityWindow   = 4096; //< [Sectors] Requests this close after the last read are read first...
+    float  SchedulerLocalityMinScore = 0.5f; //< ...if their score is at least this fraction of the best score
+
+    //! Request models and collision along the player's path ahead of time (See `notsa::StreamingPrefetcher`)
+    bool   Prefetch           = true;
+    float  PrefetchSeconds    = 5.f;   //< How far to look ahead (At the current speed)
+    float  PrefetchRadius     = 100.f; //< Models this close to the path are requested (Also the distance between look-ahead points)
+    float  PrefetchMinSpeed   = 10.f;  //< [Units/s] Nothing is prefetched below this speed
+    uint32 PrefetchMaxPending = 64;    //< Max. number of prefetched models waiting to be read
+
+    //! How to pick the model to remove when memory is needed, see `notsa::StreamingEvictionPolicy` (0 - Vanilla, 1 - LRU, 2 - LFU, 3 - Cost)
+    uint32 EvictionPolicy         = 3;
+    uint32 EvictionThrashWindowMs = 10'000; //< Models requested again this soon after being evicted count as thrashing
+    uint32 EvictionMaxCandidates  = 512;    //< Max. number of removable models looked at (From the back of the loaded list)
+
+    void Load() {
+        STORE_INI_CONFIG_VALUE(AsyncReader, true);
+        STORE_INI_CONFIG_VALUE(AsyncReaderThreads, 4u);
+        STORE_INI_CONFIG_VALUE(AsyncReaderMaxReadKiB, 1024u);
+        STORE_INI_CONFIG_VALUE(AsyncReaderMaxBatchKiB, 32u * 1024u);
+
+        STORE_INI_CONFIG_VALUE(Scheduler, true);
+        STORE_INI_CONFIG_VALUE(SchedulerDeadlineMs, 1000u);
+        STORE_INI_CONFIG_VALUE(SchedulerLocalityWindow, 4096u);
+        STORE_INI_CONFIG_VALUE(SchedulerLocalityMinScore, 0.5f);
+
+        STORE_INI_CONFIG_VALUE(Prefetch, true);
+        STORE_INI_CONFIG_VALUE(PrefetchSeconds, 5.f);
+        STORE_INI_CONFIG_VALUE(PrefetchRadius, 100.f);
+        STORE_INI_CONFIG_VALUE(PrefetchMinSpeed, 10.f);
+        STORE_INI_CONFIG_VALUE(PrefetchMaxPending, 64u);
+
+        STORE_INI_CONFIG_VALUE(EvictionPolicy, 3u);
+        STORE_INI_CONFIG_VALUE(EvictionThrashWindowMs, 10'000u);
+        STORE_INI_CONFIG_VALUE(EvictionMaxCandidates, 512u);
+    }
+} g_StreamingConfig{};
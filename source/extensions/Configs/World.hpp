@@ -0,0 +1,41 @@
+#pragma once
+#include "app_debug.h"
+
+#include "extensions/Configuration.hpp"
+
+inline struct WorldConfig {
+    INI_CONFIG_SECTION("World");
+
+    //! Test the buildings and dummies of `CWorld::FindObjectsInRange`, `FindObjectsKindaColliding` and `FindObjectsIntersectingCube` using `notsa::WorldSpatialIndex`
+    bool SpatialIndex = true;
+
+    //! Split the moving entities into islands before processing their collision, to measure what processing them in parallel could gain (See `notsa::CollisionIslands`)
+    //! Measurement only - The collision is still processed serially
+    bool CollisionIslands = false;
+
+    //! Put the moving entities that have been resting for a while to sleep, and wake them up when disturbed (See `notsa::PhysicalSleep`)
+    bool  PhysicalSleep             = false;
+    float PhysicalSleepMaxSpeed     = 0.002f; //< [Units/Time step] Entities moving slower than this (And turning slower than below) are resting
+    float PhysicalSleepMaxTurnSpeed = 0.002f; //< [Radians/Time step]
+    float PhysicalSleepTime         = 2000.f; //< [ms] How long entities have to be resting for before they're put to sleep
+
+    //! Find the nearest vehicles and peds of all peds at once, once a frame, for their scanners (See `notsa::NeighbourGrid`)
+    //! Debug builds only: `CEntityScanner::ScanForEntitiesInRange` isn't reversed, so the lists may differ from the original's (Changing the peds' AI)
+    bool  SharedScanner         = false;
+    float SharedScannerRange    = 50.f; //< [Units] Entities further than this aren't scanned
+    bool  SharedScannerParallel = false; //< Whether the peds are swept in parallel
+    bool  SharedScannerVerify   = false; //< Whether every sweep is checked against a brute-force search (Slow, for debugging)
+
+    void Load() {
+        STORE_INI_CONFIG_VALUE(SpatialIndex, true);
+        STORE_INI_CONFIG_VALUE(CollisionIslands, false);
+        STORE_INI_CONFIG_VALUE(PhysicalSleep, false);
+        STORE_INI_CONFIG_VALUE(PhysicalSleepMaxSpeed, 0.002f);
+        STORE_INI_CONFIG_VALUE(PhysicalSleepMaxTurnSpeed, 0.002f);
+        STORE_INI_CONFIG_VALUE(PhysicalSleepTime, 2000.f);
+        STORE_INI_CONFIG_VALUE(SharedScanner, false);
+        STORE_INI_CONFIG_VALUE(SharedScannerRange, 50.f);
+        STORE_INI_CONFIG_VALUE(SharedScannerParallel, false);
+        STORE_INI_CONFIG_VALUE(SharedScannerVerify, false);
+    }
+} g_WorldConfig{};
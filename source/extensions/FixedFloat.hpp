@@ -29,6 +29,9 @@ public:
 
     constexpr operator float() const { return static_cast<float>(value) / CompressValue; }
 
+    //! Get the compressed value (The counterpart of the pre-compressed value constructor)
+    constexpr T GetCompressed() const { return value; }
+
     //! Set the value (Use this if you want to set using rounding)
     constexpr void Set(float v, bool round = UseRoundingWhenConverting) {
         value = round ? static_cast<T>(v * CompressValue + 0.5f) : static_cast<T>(v * CompressValue);
@@ -0,0 +1,99 @@
+#pragma once
+
+#include <bit>
+#include <span>
+#include <vector>
+
+namespace notsa {
+/*!
+ * @brief Open-addressing (linear probing) hash table of `uint32` keys (Like the ones `CKeyGen` makes) to `uint32` values.
+ *
+ * The keys are hashes already, so they're used as-is to find the bucket.
+ * Multiple values may be inserted with the same key (As different names may end up having the same key),
+ * use the predicate overload of `Find` to tell them apart.
+ * The slots are plain data, so the table can also be a (read-only) view of memory it doesn't own (Eg.: a memory-mapped file).
+ */
+class KeyHashTable {
+public:
+    static constexpr uint32 EMPTY = UINT32_MAX; //!< Value of empty slots (So it can't be used as a value)
+
+    struct Slot {
+        uint32 Key{};
+        uint32 Value{ EMPTY };
+    };
+
+public:
+    KeyHashTable() = default;
+
+    //! Make an empty table with enough space for `numItems` items
+    explicit KeyHashTable(uint32 numItems) :
+        m_Owned(GetCapacityFor(numItems)),
+        m_Slots{ m_Owned }
+    {
+    }
+
+    //! View of the slots of another table (Eg.: One that was written to a file). `slots.size()` must be a power of 2.
+    explicit KeyHashTable(std::span<const Slot> slots) :
+        m_Slots{ slots }
+    {
+        assert(std::has_single_bit(m_Slots.size()));
+    }
+
+    KeyHashTable(const KeyHashTable&)            = delete;
+    KeyHashTable& operator=(const KeyHashTable&) = delete;
+
+    //! Number of slots needed for `numItems` items (Keeps the load factor at most 0.5)
+    static uint32 GetCapacityFor(uint32 numItems) { return std::bit_ceil(std::max(numItems * 2, 16u)); }
+
+    //! Add a value (Even if there's one with the same key already). Only possible if the table owns its slots.
+    void Insert(uint32 key, uint32 value) {
+        assert(!m_Owned.empty() && value != EMPTY);
+        assert(m_NumItems < m_Owned.size() / 2); // Otherwise lookups would get slow
+
+        auto& slot = m_Owned[FindSlot(key, [](uint32) { return false; })];
+        slot.Key   = key;
+        slot.Value = value;
+        m_NumItems++;
+    }
+
+    //! Add a value, unless there's one with the same key already
+    bool InsertUnique(uint32 key, uint32 value) {
+        if (Find(key) != EMPTY) {
+            return false;
+        }
+        Insert(key, value);
+        return true;
+    }
+
+    //! Find the first value inserted with `key` for which `pred(value)` is true, `EMPTY` if there's none
+    template<typename Pred>
+    uint32 Find(uint32 key, Pred&& pred) const {
+        return m_Slots.empty() ? EMPTY : m_Slots[FindSlot(key, pred)].Value;
+    }
+
+    //! Find the first value inserted with `key`, `EMPTY` if there's none
+    uint32 Find(uint32 key) const {
+        return Find(key, [](uint32) { return true; });
+    }
+
+    std::span<const Slot> GetSlots() const { return m_Slots; }
+
+private:
+    //! Index of the slot that has a matching value or of the empty slot where the probing stopped
+    template<typename Pred>
+    size_t FindSlot(uint32 key, Pred&& pred) const {
+        const auto mask = m_Slots.size() - 1;
+        for (auto i = (size_t)key & mask;; i = (i + 1) & mask) {
+            const auto& slot = m_Slots[i];
+            if (slot.Value == EMPTY || (slot.Key == key && pred(slot.Value))) {
+                return i;
+            }
+        }
+    }
+
+private:
+    std::vector<Slot>     m_Owned{};
+    std::span<const Slot> m_Slots{};
+    uint32                m_NumItems{};
+};
+}; // namespace notsa
@@ -0,0 +1,224 @@
+#include "StdInc.h"
+
+#include "AnimBlendFrameBatch.h"
+
+#include <xmmintrin.h>
+
+#include "AnimBlendNode.h"
+#include "AnimBlendFrameData.h"
+#include "extensions/Configs/Animation.hpp"
+
+namespace notsa {
+namespace {
+//! `mask ? a : b`
+NOTSA_FORCEINLINE __m128 Select(__m128 mask, __m128 a, __m128 b) {
+    return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+}
+
+//! `sin(x)` for `x` in [-3pi/2, 3pi/2] (Folded into [-pi/2, pi/2], then the Taylor series up to x^11 - Error is below 3e-7)
+NOTSA_FORCEINLINE __m128 Sin(__m128 x) {
+    const auto halfPi = _mm_set1_ps(HALF_PI), pi = _mm_set1_ps(PI);
+    x = Select(_mm_cmpgt_ps(x, halfPi), _mm_sub_ps(pi, x), x);
+    x = Select(_mm_cmplt_ps(x, _mm_sub_ps(_mm_setzero_ps(), halfPi)), _mm_sub_ps(_mm_sub_ps(_mm_setzero_ps(), pi), x), x);
+
+    const auto x2 = _mm_mul_ps(x, x);
+    auto       p  = _mm_set1_ps(-1.f / 39916800.f);
+    p = _mm_add_ps(_mm_mul_ps(p, x2), _mm_set1_ps(1.f / 362880.f));
+    p = _mm_add_ps(_mm_mul_ps(p, x2), _mm_set1_ps(-1.f / 5040.f));
+    p = _mm_add_ps(_mm_mul_ps(p, x2), _mm_set1_ps(1.f / 120.f));
+    p = _mm_add_ps(_mm_mul_ps(p, x2), _mm_set1_ps(-1.f / 6.f));
+    p = _mm_add_ps(_mm_mul_ps(p, x2), _mm_set1_ps(1.f));
+    return _mm_mul_ps(p, x);
+}
+};
+
+template<bool IsCompressed>
+void AnimBlendFrameBatch::Gather(AnimBlendFrameData& fd, CAnimBlendNode* const* nodes, float partialScale) {
+    Frame frame{ .Data = &fd, .FirstLane = (uint32)m_Lanes.size() };
+    for (auto it = nodes; *it; it++) {
+        const auto node = *it;
+        if (!node->IsValid()) {
+            continue;
+        }
+
+        node->I_UpdateKeyFrames<IsCompressed>();
+
+        const auto assoc = node->GetAnimAssoc();
+
+        const auto seq  = node->GetSeq();
+        const auto lane = AddLane();
+        frame.NumLanes++;
+        m_Lanes[lane] = {
+            .AssocBlend = assoc->GetBlendAmount(),
+            .AddsTrans  = seq->HasTranslation() && !assoc->HasFlag(ANIMATION_IGNORE_ROOT_TRANSLATION),
+        };
+
+        const auto blend = assoc->GetBlendAmount(partialScale);
+        if (blend <= 0.f) { // Both the rotation and translation are zero
+            continue;
+        }
+
+        const auto Set = [&](Channel c, float v) { At(c, lane) = v; };
+
+        const auto kfA = seq->GetKeyFrame<IsCompressed>(node->m_KFCurr),
+                   kfB = seq->GetKeyFrame<IsCompressed>(node->m_KFPrev);
+        Set(PROGRESS, node->GetTimeRemainingProgress<IsCompressed>());
+        Set(BLEND, blend);
+        if (seq->m_bHasRotation) {
+            const CQuaternion a = kfA->Rot, b = kfB->Rot;
+            Set(ROT_A_X, a.x); Set(ROT_A_Y, a.y); Set(ROT_A_Z, a.z); Set(ROT_A_W, a.w);
+            Set(ROT_B_X, b.x); Set(ROT_B_Y, b.y); Set(ROT_B_Z, b.z); Set(ROT_B_W, b.w);
+            Set(THETA, node->m_Theta);
+            Set(INV_SIN_THETA, node->m_InvSinTheta);
+            Set(HAS_ROT, 1.f);
+        }
+        if (seq->HasTranslation()) {
+            const CVector a = kfA->Trans, b = kfB->Trans;
+            Set(TRANS_A_X, a.x); Set(TRANS_A_Y, a.y); Set(TRANS_A_Z, a.z);
+            Set(TRANS_B_X, b.x); Set(TRANS_B_Y, b.y); Set(TRANS_B_Z, b.z);
+            Set(HAS_TRANS, 1.f);
+        }
+    }
+    m_Frames.push_back(frame);
+}
+template void AnimBlendFrameBatch::Gather<true>(AnimBlendFrameData&, CAnimBlendNode* const*, float);
+template void AnimBlendFrameBatch::Gather<false>(AnimBlendFrameData&, CAnimBlendNode* const*, float);
+
+uint32 AnimBlendFrameBatch::AddLane() {
+    const auto lane = (uint32)m_Lanes.size();
+    m_Lanes.emplace_back();
+    if (lane % 4 == 0) {
+        m_Blocks.emplace_back();
+    }
+    return lane;
+}
+
+void AnimBlendFrameBatch::Interpolate() {
+    const auto one = _mm_set1_ps(1.f), zero = _mm_setzero_ps();
+    for (auto& block : m_Blocks) {
+        const auto Load  = [&](Channel c) { return _mm_load_ps(block.Channels[c]); };
+        const auto Store = [&](Channel c, __m128 v) { _mm_store_ps(block.Channels[c], v); };
+
+        const auto t     = Load(PROGRESS),
+                   blend = Load(BLEND);
+
+        // Rotation - Same as `CQuaternion::Slerp(from = B, to = A, theta, invSinTheta, t)` (0x59C300)
+        {
+            const auto theta    = Load(THETA),
+                       invSin   = Load(INV_SIN_THETA);
+            const auto isObtuse = _mm_cmpgt_ps(theta, _mm_set1_ps(HALF_PI));
+            const auto angle    = Select(isObtuse, _mm_sub_ps(_mm_set1_ps(PI), theta), theta);
+            const auto wB       = _mm_mul_ps(Sin(_mm_mul_ps(_mm_sub_ps(one, t), angle)), invSin);
+            const auto wA       = _mm_xor_ps(_mm_mul_ps(Sin(_mm_mul_ps(t, angle)), invSin), _mm_and_ps(isObtuse, _mm_set1_ps(-0.f)));
+            const auto isZero   = _mm_cmpeq_ps(theta, zero); // Then it's just `A`
+            const auto hasRot   = _mm_cmpneq_ps(Load(HAS_ROT), zero);
+            for (auto c = 0u; c < 4; c++) {
+                const auto a = Load((Channel)(ROT_A_X + c)),
+                           b = Load((Channel)(ROT_B_X + c));
+                const auto q = Select(isZero, a, _mm_add_ps(_mm_mul_ps(b, wB), _mm_mul_ps(a, wA)));
+                Store((Channel)(OUT_ROT_X + c), _mm_and_ps(hasRot, _mm_mul_ps(q, blend)));
+            }
+        }
+
+        // Translation - Same as `lerp(B, A, t)`
+        {
+            const auto hasTrans = _mm_cmpneq_ps(Load(HAS_TRANS), zero);
+            for (auto c = 0u; c < 3; c++) {
+                const auto a  = Load((Channel)(TRANS_A_X + c)),
+                           b  = Load((Channel)(TRANS_B_X + c));
+                const auto tr = _mm_add_ps(_mm_mul_ps(a, t), _mm_mul_ps(b, _mm_sub_ps(one, t)));
+                Store((Channel)(OUT_TRANS_X + c), _mm_and_ps(hasTrans, _mm_mul_ps(tr, blend)));
+            }
+        }
+    }
+}
+
+void AnimBlendFrameBatch::Validate() {
+    for (auto lane = 0u; lane < m_Lanes.size(); lane++) {
+        const auto Get = [&](Channel c) { return At(c, lane); };
+
+        // Same as `CAnimBlendNode::I_Update`
+        const auto  t     = Get(PROGRESS),
+                    blend = Get(BLEND);
+        CQuaternion rot{};
+        CVector     trans{};
+        if (Get(HAS_ROT) != 0.f) {
+            rot.Slerp(
+                { Get(ROT_B_X), Get(ROT_B_Y), Get(ROT_B_Z), Get(ROT_B_W) },
+                { Get(ROT_A_X), Get(ROT_A_Y), Get(ROT_A_Z), Get(ROT_A_W) },
+                Get(THETA),
+                Get(INV_SIN_THETA),
+                t
+            );
+            rot *= blend;
+        }
+        if (Get(HAS_TRANS) != 0.f) {
+            trans = lerp<CVector>({ Get(TRANS_B_X), Get(TRANS_B_Y), Get(TRANS_B_Z) }, { Get(TRANS_A_X), Get(TRANS_A_Y), Get(TRANS_A_Z) }, t) * blend;
+        }
+
+        const float expected[]{ rot.x, rot.y, rot.z, rot.w, trans.x, trans.y, trans.z };
+        auto        error = 0.f;
+        for (auto c = 0u; c < std::size(expected); c++) {
+            error = std::max(error, std::abs(Get((Channel)(OUT_ROT_X + c)) - expected[c]));
+        }
+        s_Stats.NumValidated++;
+        s_Stats.MaxError = std::max(s_Stats.MaxError, error);
+        if (error > MAX_ERROR && s_Stats.NumMismatches++ == 0) { // Only the first one is logged, the rest are in the stats
+            NOTSA_LOG_WARN("Batched key-frame interpolation differs from the original by {} (Theta: {}, Progress: {})", error, Get(THETA), t);
+        }
+    }
+}
+
+void AnimBlendFrameBatch::Apply(bool isSkinned, bool removeQuatFlips) {
+    ZoneScoped;
+
+    Interpolate();
+    if (g_AnimationConfig.ValidateBatchedFrameUpdate) {
+        Validate();
+    }
+
+    const auto Get = [&](Channel c, uint32 lane) { return At(c, lane); };
+    for (const auto& frame : m_Frames) {
+        // Accumulate the nodes (In order, as the flip removal depends on the sum so far)
+        CQuaternion nextQ{};
+        CVector     nextT{};
+        float       nextBlendT{};
+        for (auto lane = frame.FirstLane; lane < frame.FirstLane + frame.NumLanes; lane++) {
+            CQuaternion q{ Get(OUT_ROT_X, lane), Get(OUT_ROT_Y, lane), Get(OUT_ROT_Z, lane), Get(OUT_ROT_W, lane) };
+            nextQ = nextQ + (!removeQuatFlips || q.Dot(nextQ) >= 0.f ? q : -q);
+
+            if (m_Lanes[lane].AddsTrans) {
+                nextT      += CVector{ Get(OUT_TRANS_X, lane), Get(OUT_TRANS_Y, lane), Get(OUT_TRANS_Z, lane) };
+                nextBlendT += m_Lanes[lane].AssocBlend;
+            }
+        }
+
+        // Apply them (Same as `FrameUpdateCallBackT`)
+        const auto fd   = frame.Data;
+        const auto fmat = isSkinned ? nullptr : RwFrameGetMatrix(fd->Frame);
+        if (!fd->KeyFramesIgnoreNodeOrientation) {
+            nextQ.Normalise();
+            if (isSkinned) {
+                fd->KeyFrame->q = nextQ;
+            } else {
+                RwMatrixSetIdentity(fmat);
+                nextQ.Get(fmat);
+            }
+        }
+        if (!fd->KeyFramesIgnoreNodeTranslation) {
+            if (isSkinned) {
+                fd->KeyFrame->t = lerp<CVector>(fd->BonePos, nextT, nextBlendT);
+            } else {
+                *RwMatrixGetPos(fmat) = lerp<CVector>(fd->FramePos, nextT, nextBlendT);
+            }
+        }
+        if (!isSkinned) {
+            RwMatrixUpdate(fmat);
+        }
+    }
+
+    m_Frames.clear();
+    m_Lanes.clear();
+    m_Blocks.clear(); // Keeps the capacity, so after the first few frames nothing's allocated anymore
+}
+}; // namespace notsa
@@ -0,0 +1,90 @@
+#pragma once
+
+#include <vector>
+
+class CAnimBlendNode;
+class AnimBlendFrameData;
+
+namespace notsa {
+/*!
+ * @brief NOTSA: Updates the key-frames of all frames of a clump at once (See `RpAnimBlendClumpUpdateAnimations`)
+ *
+ * The frame update callbacks (`FrameUpdateCallBack*`) interpolate one node (frame of an association) at a time, with a slerp (2 `sin`s) for each.
+ * Here the nodes of all frames are advanced first, and their key-frames gathered (and decompressed) into SoA blocks of 4 nodes.
+ * Then the lerps and slerps of 4 nodes are done at a time with SSE, and the results are accumulated and applied per frame, in the original order.
+ *
+ * Only the frames without velocity extraction are batched, the others are still updated by the callbacks.
+ *
+ * `sin` is approximated (See `Sin` in the .cpp), so the results aren't bit-exact - With `g_AnimationConfig.ValidateBatchedFrameUpdate`
+ * every node is also interpolated the original way (`CQuaternion::Slerp`), and the results compared, see `Stats`.
+ */
+class AnimBlendFrameBatch {
+public:
+    static constexpr float MAX_ERROR = 1e-5f; //!< Max. difference of a component of a node's result from the original's (With validation)
+
+    struct Stats {
+        uint64 NumValidated{};  //!< Number of nodes compared to the original interpolation
+        uint64 NumMismatches{}; //!< Number of those that differed by more than `MAX_ERROR`
+        float  MaxError{};      //!< Largest difference of a component so far
+    };
+
+public:
+    //! Advance the nodes of a frame (Same as `CAnimBlendNode::Update`) and gather their key-frames
+    //! @param nodes The nodes of the frame, one per association, null terminated (Same as `AnimBlendUpdateData::BlendNodeArrays`)
+    template<bool IsCompressed>
+    void Gather(AnimBlendFrameData& fd, CAnimBlendNode* const* nodes, float partialScale);
+
+    //! Interpolate the gathered nodes, and apply the result to the frames (Same as `FrameUpdateCallBack*` without velocity extraction)
+    void Apply(bool isSkinned, bool removeQuatFlips);
+
+    static const Stats& GetStats() { return s_Stats; }
+    static void         ResetStats() { s_Stats = {}; }
+
+private:
+    enum Channel : uint32 {
+        ROT_A_X, ROT_A_Y, ROT_A_Z, ROT_A_W, //!< Current key-frame
+        ROT_B_X, ROT_B_Y, ROT_B_Z, ROT_B_W, //!< Previous key-frame
+        TRANS_A_X, TRANS_A_Y, TRANS_A_Z,
+        TRANS_B_X, TRANS_B_Y, TRANS_B_Z,
+        THETA,
+        INV_SIN_THETA,
+        PROGRESS,
+        BLEND,
+        HAS_ROT,
+        HAS_TRANS,
+
+        OUT_ROT_X, OUT_ROT_Y, OUT_ROT_Z, OUT_ROT_W,
+        OUT_TRANS_X, OUT_TRANS_Y, OUT_TRANS_Z,
+
+        NUM_CHANNELS
+    };
+
+    struct Frame {
+        AnimBlendFrameData* Data{};
+        uint32              FirstLane{}, NumLanes{};
+    };
+
+    //! Lanes are per node
+    struct Lane {
+        float AssocBlend{}; //!< Blend amount of the association (Without the partial scale)
+        bool  AddsTrans{};  //!< Whether the translation is added to the frame's
+    };
+
+    //! Channels of 4 lanes (So a block is processed at once, and adding a lane is just a write most of the time, see `AddLane`)
+    struct alignas(16) Block {
+        float Channels[NUM_CHANNELS][4]{};
+    };
+
+    uint32 AddLane();
+    float& At(Channel c, uint32 lane) { return m_Blocks[lane / 4].Channels[c][lane % 4]; }
+    void   Interpolate();
+    void   Validate();
+
+private:
+    std::vector<Frame> m_Frames{};
+    std::vector<Lane>  m_Lanes{};
+    std::vector<Block> m_Blocks{}; //!< Zeroed when added, the unused lanes of the last one too (So their results are zero)
+
+    static inline Stats s_Stats{};
+};
+}; // namespace notsa
@@ -158,19 +158,26 @@ public:
         return looped;
     }
 
+    //! @notsa
+    //! @brief Advance the key-frames by the association's time step (Without interpolating them)
+    //! @return If the animation has looped
     template<bool IsCompressed>
-    NOTSA_FORCEINLINE bool I_Update(CVector& trans, CQuaternion& rot, float weight) {
-        bool looped = false;
-
-        trans = CVector{0.0f, 0.0f, 0.0f};
-        rot   = CQuaternion{0.0f, 0.0f, 0.0f, 0.0f};
-
+    NOTSA_FORCEINLINE bool I_UpdateKeyFrames() {
         if (m_BlendAssoc->IsPlaying()) {
             m_KFRemainingTime -= m_BlendAssoc->m_TimeStep;
             if (m_KFRemainingTime <= 0.0f) {
-                looped = I_NextKeyFrame<IsCompressed>();
+                return I_NextKeyFrame<IsCompressed>();
             }
         }
+        return false;
+    }
+
+    template<bool IsCompressed>
+    NOTSA_FORCEINLINE bool I_Update(CVector& trans, CQuaternion& rot, float weight) {
+        trans = CVector{0.0f, 0.0f, 0.0f};
+        rot   = CQuaternion{0.0f, 0.0f, 0.0f, 0.0f};
+
+        const auto looped = I_UpdateKeyFrames<IsCompressed>();
         
         const auto blend = m_BlendAssoc->GetBlendAmount(weight);
         if (blend > 0.0f) {
@@ -0,0 +1,136 @@
+#include "StdInc.h"
+
+#include "AnimLOD.h"
+
+#include "extensions/Configs/Animation.hpp"
+
+namespace notsa {
+auto AnimLOD::GetBones(const CPed& ped) -> Bones {
+    UpdateStats();
+
+    const auto tier = GetTier(ped);
+    s_Stats.NumPeds[(size_t)tier]++;
+    switch (tier) {
+    case Tier::FULL:
+        return Bones::ALL;
+    case Tier::REDUCED:
+        return Bones::MAIN;
+    case Tier::LOW: {
+        const auto rate = std::max(g_AnimationConfig.AnimLODLowRate, 1u);
+        if ((CTimer::GetFrameCounter() + ped.m_nRandomSeed) % rate == 0) { // Staggered, so that not all peds are evaluated in the same frame
+            return Bones::MAIN;
+        }
+        if (!GetPose(ped)) { // Nothing to restore (Not evaluated since it was created)
+            return Bones::MAIN;
+        }
+        s_Stats.NumSkipped++;
+        return Bones::NONE;
+    }
+    default:
+        NOTSA_UNREACHABLE();
+    }
+}
+
+auto AnimLOD::GetTier(const CPed& ped) -> Tier {
+    if (!g_AnimationConfig.AnimLOD || ped.IsPlayer()) {
+        return Tier::FULL;
+    }
+
+    const auto dist = (ped.GetPosition() - TheCamera.GetPosition()).Magnitude();
+    if (dist <= g_AnimationConfig.AnimLODFullDistance) {
+        return Tier::FULL;
+    }
+
+    // Fraction of the screen's height covered by the ped
+    const auto size = ped.GetModelInfo()->GetColModel()->GetBoundRadius() / (dist * SCREEN_VIEW_WINDOW);
+    if (size >= g_AnimationConfig.AnimLODReducedSize) {
+        return Tier::FULL;
+    }
+    return size >= g_AnimationConfig.AnimLODLowSize
+        ? Tier::REDUCED
+        : Tier::LOW;
+}
+
+bool AnimLOD::IsMainBone(eBoneTag bone) {
+    switch (bone) {
+    case BONE_L_BROW:
+    case BONE_R_BROW:
+    case BONE_JAW:
+    case BONE_R_FINGER:
+    case BONE_R_FINGER_01:
+    case BONE_L_FINGER:
+    case BONE_L_FINGER_01:
+    case BONE_L_TOE_0:
+    case BONE_R_TOE_0:
+    case BONE_BELLY:
+    case BONE_L_BREAST:
+    case BONE_R_BREAST:
+        return false;
+    default: // Non-skinned clumps' frames too (`BONE_UNKNOWN`)
+        return true;
+    }
+}
+
+void AnimLOD::OnAnimsUpdated(const CPed& ped, Bones bones) {
+    const auto clump = ped.GetRpClump();
+    if (bones == Bones::ALL) { // Not saved for these (Cost of copying every nearby ped's pose), so forget the older one
+        if (const auto pose = GetPose(ped)) {
+            pose->PedRef = -1;
+        }
+        return;
+    }
+    if (!IsClumpSkinned(clump)) {
+        return;
+    }
+    const auto bd     = RpAnimBlendClumpGetData(clump);
+    const auto frames = std::span{ bd->m_FrameDatas, bd->m_NumFrameData };
+
+    if (bones == Bones::NONE) { // Restore the bones that weren't evaluated (All but the ones used for velocity extraction)
+        const auto pose = GetPose(ped);
+        assert(pose); // See `GetBones`
+        for (auto i = 0u; i < frames.size(); i++) {
+            if (!frames[i].HasVelocity || !bd->m_PedPosition) {
+                *frames[i].KeyFrame = pose->Frames[i];
+            }
+        }
+        return;
+    }
+
+    // Save it, even if the ped isn't in the `LOW` tier yet, so it can be skipped as soon as it is
+    const auto idx = (size_t)GetPedPool()->GetIndex(&ped);
+    if (idx >= s_Poses.size()) {
+        s_Poses.resize(GetPedPool()->GetSize());
+    }
+    auto& pose  = s_Poses[idx];
+    pose.PedRef = GetPedPool()->GetRef(&ped);
+    pose.Frame  = CTimer::GetFrameCounter();
+    pose.Frames.resize(frames.size());
+    for (auto i = 0u; i < frames.size(); i++) {
+        pose.Frames[i] = *frames[i].KeyFrame;
+    }
+}
+
+auto AnimLOD::GetPose(const CPed& ped) -> Pose* {
+    const auto idx = (size_t)GetPedPool()->GetIndex(&ped);
+    if (idx >= s_Poses.size()) {
+        return nullptr;
+    }
+    // Only the pose of the ped's last evaluation is any good (It may have been in the `FULL` tier, or off-screen since an older one)
+    auto& pose = s_Poses[idx];
+    if (pose.PedRef != GetPedPool()->GetRef(&ped) || CTimer::GetFrameCounter() - pose.Frame > std::max(g_AnimationConfig.AnimLODLowRate, 1u)) {
+        return nullptr;
+    }
+    if (pose.Frames.size() != RpAnimBlendClumpGetData(ped.GetRpClump())->m_NumFrameData) {
+        return nullptr;
+    }
+    return &pose;
+}
+
+void AnimLOD::UpdateStats() {
+    if (s_StatsFrame == CTimer::GetFrameCounter()) {
+        return;
+    }
+    s_StatsFrame = CTimer::GetFrameCounter();
+    s_PrevStats  = std::exchange(s_Stats, {});
+}
+}; // namespace notsa
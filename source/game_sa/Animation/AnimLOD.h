@@ -0,0 +1,81 @@
+#pragma once
+
+#include <array>
+#include <vector>
+
+#include "Enums/eBoneTag.h"
+#include "RpHAnimBlendInterpFrame.h"
+
+class CPed;
+
+namespace notsa {
+/*!
+ * @brief NOTSA: Level of detail of the peds' animations
+ *
+ * `RpAnimBlendClumpUpdateAnimations` evaluates all bones of every on-screen ped every frame, however far away it is.
+ * Here the peds are put into tiers by their size on screen (Peds closer than `AnimLODFullDistance` are always in full detail):
+ * - `FULL`:    All bones are evaluated (Same as vanilla)
+ * - `REDUCED`: Only the main bones are evaluated (See `IsMainBone`) - The face, fingers, toes, etc. keep their last pose
+ * - `LOW`:     Same as `REDUCED`, but only every `AnimLODLowRate`th frame (Staggered between the peds) - The rest of the frames the ped keeps its last pose
+ *
+ * The bones that aren't evaluated still have their key-frames advanced (See `CAnimBlendNode::I_UpdateKeyFrames`), which is cheap,
+ * so they're correct as soon as they're evaluated again. The bones used for velocity extraction (The root) are always evaluated, so peds move the same way.
+ *
+ * The IK (`CPedIK::PitchForSlope`, `CPedIK::PointGunInDirection`, etc.) rotates the bones' key-frames in place every frame, expecting the animation to have
+ * just written them. So the pose of a `LOW` ped is saved whenever it's evaluated, and restored on the frames it's skipped (See `OnAnimsUpdated`),
+ * otherwise the rotations would add up over the skipped frames.
+ */
+class AnimLOD {
+public:
+    enum class Tier : uint8 {
+        FULL,
+        REDUCED,
+        LOW,
+
+        NUM
+    };
+
+    //! Which bones of a clump are evaluated by `RpAnimBlendClumpUpdateAnimationsLOD`
+    enum class Bones : uint8 {
+        ALL,  //!< All of them (Same as vanilla)
+        MAIN, //!< Only the main ones (See `IsMainBone`)
+        NONE, //!< None (Except for the ones used for velocity extraction)
+    };
+
+    struct Stats {
+        std::array<uint32, (size_t)Tier::NUM> NumPeds{};  //!< Number of (on-screen) peds in each tier (In the last frame)
+        uint32                                NumSkipped{}; //!< Number of peds in the `LOW` tier whose bones weren't evaluated (In the last frame)
+    };
+
+public:
+    //! Get the bones of an (on-screen) ped to evaluate this frame
+    static Bones GetBones(const CPed& ped);
+
+    //! Get the tier of an (on-screen) ped
+    static Tier GetTier(const CPed& ped);
+
+    //! Whether a bone is evaluated with `Bones::MAIN` (The root, spine, head and limbs)
+    static bool IsMainBone(eBoneTag bone);
+
+    //! Save the pose of an (on-screen) ped, or restore it if its bones weren't evaluated - To be called right after its animations were updated (Before the IK)
+    static void OnAnimsUpdated(const CPed& ped, Bones bones);
+
+    static const Stats& GetStats() { return s_PrevStats; }
+
+private:
+    //! Last evaluated pose of a ped (Before the IK)
+    struct Pose {
+        int32                                PedRef{ -1 }; //!< Pool reference of the ped (The slot may have been reused since)
+        uint32                               Frame{};      //!< Frame it was saved in
+        std::vector<RpHAnimBlendInterpFrame> Frames{};
+    };
+
+    static void  UpdateStats();
+    static Pose* GetPose(const CPed& ped);
+
+private:
+    static inline std::vector<Pose> s_Poses{}; //!< By ped pool index
+    static inline Stats  s_Stats{}, s_PrevStats{};
+    static inline uint32 s_StatsFrame{};
+};
+}; // namespace notsa
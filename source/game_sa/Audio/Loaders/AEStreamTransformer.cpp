@@ -1,6 +1,7 @@
 #include "StdInc.h" // TODO: Remove
 
 #include <cstring>
+#include <emmintrin.h>
 
 #include "AEStreamTransformer.h"
 
@@ -16,7 +17,28 @@ void CAEStreamTransformer::Initialise() {
 void CAEStreamTransformer::TransformBuffer(void* buffer, size_t size, uint32 position) {
     uint8* buf = reinterpret_cast<uint8*>(buffer);
 
-    for (size_t i = 0; i < size; i++)
+    // NOTSA: The key repeats every 16 bytes, so rotate it by `position` once, then XOR 16 bytes at a time
+    size_t i = 0;
+    if (size >= 16) {
+        alignas(16) uint8 key[16];
+        for (size_t k = 0; k < 16; k++)
+            key[k] = table[(position + k) & 0xF];
+        const __m128i xkey = _mm_load_si128(reinterpret_cast<const __m128i*>(key));
+
+        for (; i + 64 <= size; i += 64) {
+            const auto p = reinterpret_cast<__m128i*>(buf + i);
+            _mm_storeu_si128(p + 0, _mm_xor_si128(_mm_loadu_si128(p + 0), xkey));
+            _mm_storeu_si128(p + 1, _mm_xor_si128(_mm_loadu_si128(p + 1), xkey));
+            _mm_storeu_si128(p + 2, _mm_xor_si128(_mm_loadu_si128(p + 2), xkey));
+            _mm_storeu_si128(p + 3, _mm_xor_si128(_mm_loadu_si128(p + 3), xkey));
+        }
+        for (; i + 16 <= size; i += 16) {
+            const auto p = reinterpret_cast<__m128i*>(buf + i);
+            _mm_storeu_si128(p, _mm_xor_si128(_mm_loadu_si128(p), xkey));
+        }
+    }
+
+    for (; i < size; i++)
         buf[i] ^= table[(position + i) & 0xF];
 }
 
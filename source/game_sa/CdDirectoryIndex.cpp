@@ -0,0 +1,47 @@
+#include "StdInc.h"
+
+#include "CdDirectoryIndex.h"
+#include "extensions/File.hpp"
+
+namespace notsa {
+namespace {
+constexpr uint32 MAX_NUM_ENTRIES = 1 << 20; //!< Sanity check for the entry count read from the IMG
+};
+
+bool CdDirectoryIndex::Open(const char* imgPath) {
+    ZoneScoped;
+
+    const notsa::ScopeGuard recordTime{ [begin = std::chrono::steady_clock::now()] {
+        s_Stats.TotalTimeMs += std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - begin).count();
+    } };
+
+    m_Entries.clear();
+
+    notsa::File img{ imgPath, "rb" };
+    if (!img) {
+        return false;
+    }
+
+    char   version[4]{};
+    uint32 numEntries{};
+    if (img.Read(version, sizeof(version)) != sizeof(version) || img.Read(&numEntries, sizeof(numEntries)) != sizeof(numEntries)) {
+        return false;
+    }
+    assert((std::string_view{ version, 4u } == "VER2"));
+    if (numEntries > MAX_NUM_ENTRIES) {
+        NOTSA_LOG_WARN("CdDirectoryIndex: `{}` has too many entries ({})", imgPath, numEntries);
+        return false;
+    }
+
+    // Read the whole directory at once
+    m_Entries.resize(numEntries);
+    const auto entriesSize = numEntries * sizeof(CDirectory::DirectoryInfo);
+    if (img.Read(m_Entries.data(), entriesSize) != entriesSize) {
+        m_Entries.clear();
+        return false;
+    }
+    s_Stats.NumRead++;
+
+    return true;
+}
+}; // namespace notsa
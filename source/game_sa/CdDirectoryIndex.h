@@ -0,0 +1,39 @@
+#pragma once
+
+#include <span>
+#include <vector>
+
+#include "Directory.h"
+
+namespace notsa {
+/*!
+ * @brief NOTSA: The directory of an IMG archive, read all at once.
+ *
+ * The directory is read with a single read, instead of entry-by-entry.
+ */
+class CdDirectoryIndex {
+public:
+    struct Stats {
+        uint32 NumRead{};     //!< Number of directories read
+        float  TotalTimeMs{}; //!< Time spent in `Open`
+    };
+
+public:
+    /*!
+     * @brief Read the directory of an IMG archive
+     * @param imgPath Path of the IMG archive
+     * @return Whenever the directory was read - If not, the IMG couldn't be read
+     */
+    bool Open(const char* imgPath);
+
+    //! The directory entries, in the same order as in the IMG
+    std::span<const CDirectory::DirectoryInfo> GetEntries() const { return m_Entries; }
+
+    static const Stats& GetStats() { return s_Stats; }
+
+private:
+    std::vector<CDirectory::DirectoryInfo> m_Entries{};
+
+    static inline Stats s_Stats{};
+};
+}; // namespace notsa
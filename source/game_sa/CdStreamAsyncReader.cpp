@@ -0,0 +1,163 @@
+#include "StdInc.h"
+
+#include "CdStreamAsyncReader.h"
+#include "StreamingInfo.h"
+
+namespace notsa {
+CdStreamAsyncReader::CdStreamAsyncReader(uint32 numThreads, uint32 maxReadSectors) :
+    m_MaxReadSectors{ std::max(maxReadSectors, 1u) }
+{
+    numThreads = std::max(numThreads, 1u);
+    m_Workers.reserve(numThreads);
+    for (auto i = 0u; i < numThreads; i++) {
+        m_Workers.emplace_back([this](std::stop_token stop) { WorkerMain(stop); });
+    }
+    NOTSA_LOG_DEBUG("CdStreamAsyncReader: Started {} threads (Max. read: {} sectors)", numThreads, m_MaxReadSectors);
+}
+
+CdStreamAsyncReader::~CdStreamAsyncReader() {
+    for (auto& w : m_Workers) {
+        w.request_stop();
+    }
+    m_ReadsCV.notify_all();
+    m_Workers.clear(); // Joins
+}
+
+void CdStreamAsyncReader::Submit(std::span<const Request> requests) {
+    if (requests.empty()) {
+        return;
+    }
+
+    // Sort by position on disk, so that requests that are next to each other can be coalesced
+    std::vector<const Request*> sorted{};
+    sorted.reserve(requests.size());
+    for (const auto& r : requests) {
+        sorted.push_back(&r);
+    }
+    rng::sort(sorted, {}, [](const Request* r) { return r->Pos.ToInt(); }); // By file, then offset
+
+    std::vector<Read> reads{};
+    for (const auto* r : sorted) {
+        if (!reads.empty()) {
+            auto& prev = reads.back();
+            if (   prev.Pos.FileID == r->Pos.FileID
+                && prev.Pos.Offset + prev.NumSectors == r->Pos.Offset                  // Adjacent on disk
+                && prev.Buffer + prev.NumSectors * STREAMING_SECTOR_SIZE == r->Buffer  // Adjacent in memory
+                && prev.NumSectors + r->NumSectors <= m_MaxReadSectors
+            ) {
+                prev.NumSectors += r->NumSectors;
+                prev.Parts.emplace_back(ReadPart{ r->UserData, r->OnRead });
+                continue;
+            }
+        }
+        reads.emplace_back(Read{
+            .Pos        = r->Pos,
+            .NumSectors = r->NumSectors,
+            .Buffer     = r->Buffer,
+            .Parts      = { ReadPart{ r->UserData, r->OnRead } },
+        });
+    }
+
+    m_Stats.NumRequests += requests.size();
+    m_Stats.NumReads    += reads.size();
+    m_NumPending        += (uint32)requests.size();
+
+    {
+        std::scoped_lock lock{ m_ReadsMtx };
+        for (auto& read : reads) {
+            m_Reads.emplace_back(std::move(read));
+        }
+    }
+    m_ReadsCV.notify_all();
+}
+
+bool CdStreamAsyncReader::PollCompletion(Completion& out) {
+    std::scoped_lock lock{ m_CompletionsMtx };
+    if (m_Completions.empty()) {
+        return false;
+    }
+    out = m_Completions.front();
+    m_Completions.pop_front();
+    m_NumPending--;
+    return true;
+}
+
+CdStreamAsyncReader::Completion CdStreamAsyncReader::WaitCompletion() {
+    assert(m_NumPending > 0);
+
+    std::unique_lock lock{ m_CompletionsMtx };
+    m_CompletionsCV.wait(lock, [this] { return !m_Completions.empty(); });
+    const auto c = m_Completions.front();
+    m_Completions.pop_front();
+    m_NumPending--;
+    return c;
+}
+
+void CdStreamAsyncReader::WorkerMain(std::stop_token stop) {
+#ifdef TRACY_ENABLE
+    tracy::SetThreadName("CdStreamAsyncReader");
+#endif
+
+    // Manual-reset, as required by `GetOverlappedResult`
+    const auto event = CreateEvent(nullptr, TRUE, FALSE, nullptr);
+    while (true) {
+        Read read;
+        {
+            std::unique_lock lock{ m_ReadsMtx };
+            if (!m_ReadsCV.wait(lock, stop, [this] { return !m_Reads.empty(); })) {
+                break; // Stop requested
+            }
+            read = std::move(m_Reads.front());
+            m_Reads.pop_front();
+        }
+
+        const auto success = DoRead(read, event);
+        if (success) {
+            m_Stats.NumSectorsRead += read.NumSectors;
+        } else {
+            m_Stats.NumFailures++;
+            NOTSA_LOG_WARN("CdStreamAsyncReader: Failed reading {} sectors at {}:{} (Error: {})", read.NumSectors, (uint32)read.Pos.FileID, (uint32)read.Pos.Offset, GetLastError());
+        }
+
+        if (success) {
+            for (const auto& part : read.Parts) {
+                if (part.OnRead) {
+                    std::invoke(part.OnRead);
+                }
+            }
+        }
+
+        {
+            std::scoped_lock lock{ m_CompletionsMtx };
+            for (const auto& part : read.Parts) {
+                m_Completions.emplace_back(Completion{ .UserData = part.UserData, .Success = success });
+            }
+        }
+        m_CompletionsCV.notify_all();
+    }
+    CloseHandle(event);
+}
+
+bool CdStreamAsyncReader::DoRead(const Read& read, HANDLE event) {
+    ZoneScoped;
+
+    const auto file = gStreamFileHandles[read.Pos.FileID];
+    if (!file) {
+        return false;
+    }
+
+    const auto offset = (uint64)read.Pos.Offset * STREAMING_SECTOR_SIZE;
+
+    OVERLAPPED overlapped{};
+    overlapped.Offset     = (DWORD)(offset);
+    overlapped.OffsetHigh = (DWORD)(offset >> 32);
+    overlapped.hEvent     = event;
+
+    // Works with both overlapped and synchronous handles, in the latter case `ReadFile` just blocks
+    if (!ReadFile(file, read.Buffer, read.NumSectors * STREAMING_SECTOR_SIZE, nullptr, &overlapped) && GetLastError() != ERROR_IO_PENDING) {
+        return false;
+    }
+    DWORD numBytesRead{};
+    return GetOverlappedResult(file, &overlapped, &numBytesRead, TRUE);
+}
+}; // namespace notsa
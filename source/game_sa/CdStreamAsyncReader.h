@@ -0,0 +1,118 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <span>
+#include <thread>
+#include <vector>
+
+#include "CdStreamInfo.h"
+
+namespace notsa {
+/*!
+ * @brief NOTSA: Reads sectors from the IMG archives opened by `CdStreamOpen` using a pool of worker threads.
+ *
+ * Unlike the `CdStream` channels (Which can only do a single read at a time each) this
+ * allows any number of reads to be in flight. Requests submitted together that are adjacent
+ * both on disk and in memory are coalesced into a single read.
+ * The reads are positional (`OVERLAPPED` offset), so they don't interfere with `CdStreamThread`.
+ * Optionally the data can be processed on the reader thread as well (See `Request::OnRead`)
+ */
+class CdStreamAsyncReader {
+public:
+    struct Request {
+        CdStreamPos Pos{};        //!< Where to start reading from
+        uint32      NumSectors{}; //!< How many sectors to read
+        uint8*      Buffer{};     //!< Where to read into - Must be at least `NumSectors * STREAMING_SECTOR_SIZE` bytes
+        uint32      UserData{};   //!< Passed back in the `Completion`
+
+        //! Called on the reader thread once the data has been read successfully (Before the completion is queued).
+        //! Can be used to process (decode) the data off the main thread - Mind that it must be thread-safe.
+        std::function<void()> OnRead{};
+    };
+
+    struct Completion {
+        uint32 UserData{};
+        bool   Success{};
+    };
+
+    struct Stats {
+        std::atomic<uint64> NumRequests{};    //!< Number of requests submitted
+        std::atomic<uint64> NumReads{};       //!< Number of reads issued (after coalescing)
+        std::atomic<uint64> NumSectorsRead{}; //!< Number of sectors read successfully
+        std::atomic<uint64> NumFailures{};    //!< Number of reads failed
+    };
+
+public:
+    /*!
+     * @param numThreads     Number of worker threads (At least 1)
+     * @param maxReadSectors Coalesced reads are not made bigger than this (A single request may still be bigger)
+     */
+    CdStreamAsyncReader(uint32 numThreads, uint32 maxReadSectors);
+    ~CdStreamAsyncReader();
+
+    CdStreamAsyncReader(const CdStreamAsyncReader&)            = delete;
+    CdStreamAsyncReader& operator=(const CdStreamAsyncReader&) = delete;
+
+    /*!
+     * @brief Queue reads. Requests in the same call are coalesced (If possible).
+     */
+    void Submit(std::span<const Request> requests);
+
+    /*!
+     * @brief Pop a completion (if any) without blocking.
+     * @return Whenever `out` was set
+     */
+    bool PollCompletion(Completion& out);
+
+    /*!
+     * @brief Pop a completion, blocking until one is available.
+     * @warning There must be pending requests (See `GetNumPending`), otherwise this blocks forever.
+     */
+    Completion WaitCompletion();
+
+    //! Number of requests that have been submitted, but whose completions haven't been popped yet
+    uint32 GetNumPending() const { return m_NumPending; }
+
+    //! Number of worker threads
+    uint32 GetNumThreads() const { return (uint32)m_Workers.size(); }
+
+    const Stats& GetStats() const { return m_Stats; }
+
+private:
+    //! A request that is part of a `Read`
+    struct ReadPart {
+        uint32                UserData{};
+        std::function<void()> OnRead{};
+    };
+
+    //! A (possibly coalesced) read
+    struct Read {
+        CdStreamPos           Pos{};
+        uint32                NumSectors{};
+        uint8*                Buffer{};
+        std::vector<ReadPart> Parts{}; //!< Each request that is part of this read
+    };
+
+    void WorkerMain(std::stop_token stop);
+    bool DoRead(const Read& read, HANDLE event);
+
+private:
+    uint32                    m_MaxReadSectors{};
+    std::vector<std::jthread> m_Workers{};
+
+    std::mutex                  m_ReadsMtx{};
+    std::condition_variable_any m_ReadsCV{};
+    std::deque<Read>            m_Reads{};
+
+    std::mutex              m_CompletionsMtx{};
+    std::condition_variable m_CompletionsCV{};
+    std::deque<Completion>  m_Completions{};
+
+    std::atomic<uint32> m_NumPending{};
+    Stats               m_Stats{};
+};
+}; // namespace notsa
@@ -1,6 +1,7 @@
 #include "StdInc.h"
 
 #include "ColModel.h"
+#include "ColTriangleBVH.h"
 
 //#define COL_EXTRA_DEBUG
 
@@ -17,10 +18,10 @@ void CColModel::InjectHooks() {
     RH_ScopedInstall(operator new, 0x40FC30);
     RH_ScopedInstall(operator delete, 0x40FC40);
     RH_ScopedInstall(operator=, 0x40F7C0);
-    RH_ScopedInstall(MakeMultipleAlloc, 0x40F740);
+    RH_ScopedInstall(MakeMultipleAlloc, 0x40F740, {.locked = true}); // Locked because of `notsa::ColTriangleBVH::Remove`
     RH_ScopedOverloadedInstall(AllocateData, "void", 0x40F810, void(CColModel::*)());
     RH_ScopedOverloadedInstall(AllocateData, "params", 0x40F870, void(CColModel::*)(int32, int32, int32, int32, int32, bool));
-    RH_ScopedInstall(RemoveCollisionVolumes, 0x40F9E0);
+    RH_ScopedInstall(RemoveCollisionVolumes, 0x40F9E0, {.locked = true}); // Locked because of `notsa::ColTriangleBVH::Remove`
     RH_ScopedInstall(CalculateTrianglePlanes, 0x40FA30);
     RH_ScopedInstall(RemoveTrianglePlanes, 0x40FA40);
 }
@@ -64,6 +65,7 @@ void CColModel::MakeMultipleAlloc() {
     assert(colData);
 
     colData->Copy(*m_pColData);
+    notsa::ColTriangleBVH::Remove(*m_pColData); // NOTSA
     delete m_pColData;
 
     m_bIsSingleColDataAlloc = false;
@@ -135,6 +137,8 @@ void CColModel::RemoveCollisionVolumes() {
 
     DEV_LOG_COL("Removing: {} [ColSlot: {}]", LOG_PTR(this), m_nColSlot);
 
+    notsa::ColTriangleBVH::Remove(*m_pColData); // NOTSA
+
     if (m_bIsSingleColDataAlloc) {
         CCollision::RemoveTrianglePlanes(m_pColData);
         CMemoryMgr::Free(m_pColData);
@@ -276,6 +276,21 @@ bool CColStore::LoadCol(int32 colSlot, uint8* data, int32 dataSize)
     return true;
 }
 
+// NOTSA: Link the col models decoded by `CFileLoader::DecodeCollisionFile`
+bool CColStore::LoadCol(int32 colSlot, CFileLoader::DecodedColFile& decoded)
+{
+    assert(colSlot <= 255);
+
+    auto* def = ms_pColPool->GetAt(colSlot);
+    assert(def->m_nModelIdStart <= def->m_nModelIdEnd); // Decoding isn't supported when loading the first time (See `LoadCollisionFileFirstTime`)
+
+    if (!CFileLoader::LinkCollisionFile(decoded, colSlot))
+        return false;
+
+    def->m_bActive = true;
+    return true;
+}
+
 // 0x410860
 void CColStore::LoadCollision(CVector pos, bool bIgnorePlayerVeh)
 {
@@ -329,7 +344,7 @@ void CColStore::LoadCollision(CVector pos, bool bIgnorePlayerVeh)
 
             def->m_bCollisionIsRequired = false;
         }
-        else if (def->m_bActive)
+        else if (def->m_bActive && !CStreaming::ms_Prefetcher.IsCollisionWanted(i)) // NOTSA: Keep prefetched collision (See `notsa::StreamingPrefetcher`)
             CStreaming::RemoveModel(COLToModelId(i));
     }
 
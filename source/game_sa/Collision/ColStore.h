@@ -3,6 +3,7 @@
 #include "Rect.h"
 #include "Vector.h"
 #include "Pool.h"
+#include "FileLoader.h"
 #include <Enums/eAreaCodes.h>
 
 // thanks to jte for reversing this
@@ -48,6 +49,7 @@ public:
     static void LoadAllCollision();
     static void LoadCol(int32 colSlot, const char* filename);
     static bool LoadCol(int32 colSlot, uint8* data, int32 dataSize);
+    static bool LoadCol(int32 colSlot, CFileLoader::DecodedColFile& decoded); // NOTSA
     static void LoadCollision(CVector pos, bool bIgnorePlayerVeh);
     static void RemoveAllCollision();
     static void RemoveCol(int32 colSlot);
@@ -0,0 +1,216 @@
+#include "StdInc.h"
+
+#include "ColTriangleBVH.h"
+
+#include <numeric>
+#include <unordered_map>
+
+#include "extensions/Configs/Collision.hpp"
+
+namespace notsa {
+namespace {
+//! Trees by the col data they were built for
+std::unordered_map<const CCollisionData*, ColTriangleBVH> s_BVHs{};
+};
+
+//! Bounds of a triangle [In 1/128 units]
+struct ColTriangleBVH::TriBounds {
+    int16 Min[3]{}, Max[3]{};
+    int32 Centre[3]{}; //!< `Min + Max` (So, 2x the centre of the box)
+};
+
+ColTriangleBVH::ColTriangleBVH(const CCollisionData& cd) :
+    m_Identity{ GetIdentity(cd) }
+{
+    ZoneScoped;
+
+    assert(cd.m_nNumTriangles);
+
+    std::vector<TriBounds> bounds(cd.m_nNumTriangles);
+    for (auto i = 0u; i < cd.m_nNumTriangles; i++) {
+        const auto& tri = cd.m_pTriangles[i];
+        auto&       b   = bounds[i];
+        for (auto axis = 0; axis < 3; axis++) {
+            const auto GetCoord = [&](uint16 vtx) {
+                const auto& v = cd.m_pVertices[vtx];
+                return axis == 0 ? v.x.GetCompressed() : axis == 1 ? v.y.GetCompressed() : v.z.GetCompressed();
+            };
+            const auto [min, max] = std::minmax({ GetCoord(tri.vA), GetCoord(tri.vB), GetCoord(tri.vC) });
+            b.Min[axis]    = min;
+            b.Max[axis]    = max;
+            b.Centre[axis] = (int32)min + (int32)max;
+        }
+    }
+
+    // Split at the median, so leaves have at least 2 triangles, and there are less nodes than triangles
+    std::vector<uint16> tris(cd.m_nNumTriangles);
+    std::iota(tris.begin(), tris.end(), (uint16)0);
+    m_Nodes.reserve(std::max<size_t>(cd.m_nNumTriangles - 1, 1));
+    m_Packs.reserve(cd.m_nNumTriangles / 2 + 1);
+    m_Nodes.emplace_back();
+    BuildNode(cd, tris, bounds, 0, 0, cd.m_nNumTriangles);
+    m_Nodes.shrink_to_fit();
+    m_Packs.shrink_to_fit();
+}
+
+void ColTriangleBVH::BuildNode(const CCollisionData& cd, std::vector<uint16>& tris, const std::vector<TriBounds>& bounds, uint16 nodeIdx, uint16 first, uint16 num) {
+    int16 min[3]{ INT16_MAX, INT16_MAX, INT16_MAX }, max[3]{ INT16_MIN, INT16_MIN, INT16_MIN };
+    int32 cmin[3]{ INT32_MAX, INT32_MAX, INT32_MAX }, cmax[3]{ INT32_MIN, INT32_MIN, INT32_MIN };
+    for (auto i = first; i < first + num; i++) {
+        const auto& b = bounds[tris[i]];
+        for (auto axis = 0; axis < 3; axis++) {
+            min[axis]  = std::min(min[axis], b.Min[axis]);
+            max[axis]  = std::max(max[axis], b.Max[axis]);
+            cmin[axis] = std::min(cmin[axis], b.Centre[axis]);
+            cmax[axis] = std::max(cmax[axis], b.Centre[axis]);
+        }
+    }
+
+    const auto Grow = [](int16 v, int32 by) {
+        return (int16)std::clamp<int32>(v + by, INT16_MIN, INT16_MAX);
+    };
+    {
+        auto& node = m_Nodes[nodeIdx];
+        node.Min   = CompressedVector{ Grow(min[0], -BOX_MARGIN), Grow(min[1], -BOX_MARGIN), Grow(min[2], -BOX_MARGIN) };
+        node.Max   = CompressedVector{ Grow(max[0], BOX_MARGIN), Grow(max[1], BOX_MARGIN), Grow(max[2], BOX_MARGIN) };
+    }
+
+    if (num <= MAX_LEAF_TRIANGLES) {
+        auto& node   = m_Nodes[nodeIdx];
+        node.Index   = (uint16)m_Packs.size();
+        node.NumTris = num;
+        m_Packs.emplace_back().Set(cd, std::span{ tris }.subspan(first, num));
+        return;
+    }
+
+    // Split along the axis the centres are the most spread out on
+    auto splitAxis = 0;
+    for (auto a = 1; a < 3; a++) {
+        if (cmax[a] - cmin[a] > cmax[splitAxis] - cmin[splitAxis]) {
+            splitAxis = a;
+        }
+    }
+    const auto half = (uint16)(num / 2);
+    std::nth_element(tris.begin() + first, tris.begin() + first + half, tris.begin() + first + num, [&](uint16 a, uint16 b) {
+        return bounds[a].Centre[splitAxis] < bounds[b].Centre[splitAxis];
+    });
+
+    const auto children = (uint16)m_Nodes.size();
+    m_Nodes[nodeIdx].Index = children;
+    m_Nodes.emplace_back();
+    m_Nodes.emplace_back();
+    BuildNode(cd, tris, bounds, children, first, half);
+    BuildNode(cd, tris, bounds, children + 1, first + half, num - half);
+}
+
+void ColTriangleBVH::GetTrianglesInBox(const CBox& box, std::vector<uint16>& out) const {
+    out.clear();
+
+    const auto fbox = ToFixedBox(box);
+    Traverse(
+        [&](const Node& node, float&) { return IsBoxInBox(node, fbox); },
+        [] { return FLT_MAX; },
+        [&](const ColTrianglePack& pack) {
+            s_Stats.NumTrisTested += pack.NumTris;
+            out.insert(out.end(), pack.Tris, pack.Tris + pack.NumTris);
+            return true;
+        }
+    );
+    rng::sort(out);
+}
+
+auto ColTriangleBVH::ToFixedBox(const CBox& box) -> FixedBox {
+    const auto ToFixed = [](float v, bool roundUp) {
+        const auto f = v * 128.f;
+        return (int32)std::clamp(roundUp ? std::ceil(f) : std::floor(f), (float)INT16_MIN, (float)INT16_MAX);
+    };
+    return {
+        { ToFixed(box.m_vecMin.x, false), ToFixed(box.m_vecMin.y, false), ToFixed(box.m_vecMin.z, false) },
+        { ToFixed(box.m_vecMax.x, true), ToFixed(box.m_vecMax.y, true), ToFixed(box.m_vecMax.z, true) },
+    };
+}
+
+auto ColTriangleBVH::GetSIMDMode() -> SIMDMode {
+    if (!g_CollisionConfig.TriangleSIMD) {
+        return SIMDMode::DISABLED;
+    }
+    return g_CollisionConfig.ValidateTriangleSIMD ? SIMDMode::VALIDATE : SIMDMode::ENABLED;
+}
+
+void ColTriangleBVH::OnSIMDMiss(uint16 triIdx) {
+    s_Stats.NumSIMDMisses++;
+    NOTSA_LOG_WARN("Triangle {} was hit, but it was culled by the SIMD kernel", triIdx);
+}
+
+void ColTriangleBVH::Build(const CCollisionData& cd) {
+    Remove(cd);
+    if (!g_CollisionConfig.TriangleBVH || cd.m_nNumTriangles < std::max(g_CollisionConfig.TriangleBVHMinTriangles, 2u)) {
+        return;
+    }
+    const auto& bvh = s_BVHs.emplace(&cd, ColTriangleBVH{ cd }).first->second;
+    s_Stats.NumBVHs++;
+    s_Stats.NumTris  += bvh.m_Identity.NumTris;
+    s_Stats.NumBytes += bvh.GetNumBytes();
+}
+
+void ColTriangleBVH::Remove(const CCollisionData& cd) {
+    const auto it = s_BVHs.find(&cd);
+    if (it == s_BVHs.end()) {
+        return;
+    }
+    s_Stats.NumBVHs--;
+    s_Stats.NumTris  -= it->second.m_Identity.NumTris;
+    s_Stats.NumBytes -= it->second.GetNumBytes();
+    s_BVHs.erase(it);
+}
+
+void ColTriangleBVH::RemoveAll() {
+    s_BVHs.clear();
+    s_Stats.NumBVHs  = 0;
+    s_Stats.NumTris  = 0;
+    s_Stats.NumBytes = 0;
+}
+
+const ColTriangleBVH* ColTriangleBVH::Get(const CCollisionData& cd) {
+    if (!g_CollisionConfig.TriangleBVH || cd.m_nNumTriangles < g_CollisionConfig.TriangleBVHMinTriangles || s_BVHs.empty()) {
+        return nullptr;
+    }
+    const auto it = s_BVHs.find(&cd);
+    if (it == s_BVHs.end()) {
+        return nullptr;
+    }
+    const auto& bvh = it->second;
+    if (bvh.m_Identity != GetIdentity(cd)) {
+        NOTSA_LOG_WARN("Col data {} was modified without removing its tree", LOG_PTR(&cd));
+        return nullptr;
+    }
+    return &bvh;
+}
+
+auto ColTriangleBVH::GetIdentity(const CCollisionData& cd) -> Identity {
+    // FNV-1a - Only a few triangles are hashed, as this is done on every `Get`
+    uint32     hash = 2166136261u;
+    const auto Hash = [&](const auto& v) {
+        for (const auto b : std::as_bytes(std::span{ &v, 1 })) {
+            hash = (hash ^ (uint32)b) * 16777619u;
+        }
+    };
+    if (cd.m_nNumTriangles && cd.m_pTriangles && cd.m_pVertices) {
+        for (const auto i : { 0u, cd.m_nNumTriangles / 2u, cd.m_nNumTriangles - 1u }) {
+            const auto& tri = cd.m_pTriangles[i];
+            Hash(tri);
+            Hash(cd.m_pVertices[tri.vA]);
+            Hash(cd.m_pVertices[tri.vB]);
+            Hash(cd.m_pVertices[tri.vC]);
+        }
+    }
+    return { .Triangles = cd.m_pTriangles, .Vertices = cd.m_pVertices, .NumTris = cd.m_nNumTriangles, .Hash = hash };
+}
+
+void ColTriangleBVH::ResetStats() {
+    s_Stats.NumQueries    = 0;
+    s_Stats.NumTrisTested = 0;
+    s_Stats.NumTrisCulled = 0;
+    s_Stats.NumSIMDMisses = 0;
+}
+}; // namespace notsa
@@ -0,0 +1,336 @@
+#pragma once
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <span>
+#include <vector>
+
+#include "Vector.h"
+#include "Box.h"
+#include "ColLine.h"
+#include "ColSphere.h"
+#include "CompressedVector.h"
+#include "ColTrianglePack.h"
+
+class CCollisionData;
+class CColTriangle;
+
+namespace notsa {
+/*!
+ * @brief NOTSA: Bounding volume hierarchy of the triangles of a col model.
+ *
+ * `CCollision::ProcessLineOfSight` (and friends) test a line against every triangle of the col model once the line hits its bounding box,
+ * which for the bigger buildings means thousands of triangles for every line.
+ * The tree is built when the col model is loaded (See `CFileLoader::LoadCollisionFile` and `CFileLoader::LinkCollisionFile`), and kept in a table keyed by the col data
+ * (`CCollisionData`'s layout can't change). The hooks freeing col data are locked, so the trees are always removed with it,
+ * and the entries are validated against the data anyways, in case the address got reused (See `Get`).
+ *
+ * The nodes' boxes are in the same fixed-point format as the vertices (`CompressedVector`), so they're exact and nodes are only 16 bytes.
+ * The triangles of each leaf are in a `ColTrianglePack`, so the leaf's triangles are first tested all at once with SSE,
+ * and only the ones that may be hit are processed by the caller.
+ * The queries give the same results as testing all triangles in order (See `ProcessLine`).
+ */
+class ColTriangleBVH {
+public:
+    static constexpr uint32 MAX_LEAF_TRIANGLES = ColTrianglePack::SIZE; //!< Nodes with more triangles than this are split
+    static constexpr int16  BOX_MARGIN         = 16; //!< [1/128 units] Boxes are grown by this much, as the triangle tests use the (quantized) plane of the triangle, which may be a bit off
+    static constexpr uint32 MAX_DEPTH          = 32; //!< The tree is split at the median, so with at most 65535 triangles it's never deeper than 16
+
+    struct Node {
+        CompressedVector Min{}, Max{}; //!< Bounding box of the triangles (Grown by `BOX_MARGIN`)
+        uint16           Index{};      //!< Inner nodes: Index of the 1st child (The 2nd is right after it) - Leaves: Index of the pack in `m_Packs`
+        uint16           NumTris{};    //!< 0 for inner nodes
+    };
+    VALIDATE_SIZE(Node, 0x10);
+
+    struct Stats {
+        uint32 NumBVHs{};       //!< Number of col models that have a tree
+        uint32 NumTris{};       //!< Total number of triangles in them
+        uint64 NumBytes{};      //!< Memory used by the trees
+        uint64 NumQueries{};    //!< Number of queries using a tree
+        uint64 NumTrisTested{}; //!< Number of triangles tested by those queries
+        uint64 NumTrisCulled{}; //!< Number of triangles of the visited leaves that the SIMD kernels culled (So they weren't tested)
+        uint64 NumSIMDMisses{}; //!< Number of triangles that were hit, but the SIMD kernels culled them (See `g_CollisionConfig.ValidateTriangleSIMD`, should be 0)
+    };
+
+public:
+    //! Build the tree of the triangles of `cd`
+    explicit ColTriangleBVH(const CCollisionData& cd);
+
+    ColTriangleBVH(ColTriangleBVH&&)            = default;
+    ColTriangleBVH& operator=(ColTriangleBVH&&) = default;
+
+    //! Build (or rebuild) the tree of `cd`, if it has enough triangles (See `g_CollisionConfig`)
+    static void Build(const CCollisionData& cd);
+
+    //! Remove the tree of `cd` (Must be called before the triangles of `cd` are modified or freed)
+    static void Remove(const CCollisionData& cd);
+
+    //! Remove all trees
+    static void RemoveAll();
+
+    //! Get the tree of `cd`, null if it doesn't have one (Or they're disabled, or `cd` isn't the data the tree was built from anymore)
+    static const ColTriangleBVH* Get(const CCollisionData& cd);
+
+    static const Stats& GetStats() { return s_Stats; }
+    static void         ResetStats();
+
+    /*!
+     * @brief Process the triangles the line may hit, the ones in the closest leaves first.
+     *
+     * The result is the same as calling `fn` for all triangles in order:
+     * If 2 triangles are hit at the same distance the one with the lower index wins (Even if it's processed later).
+     *
+     * @param line         The line (In object space)
+     * @param maxTouchDist [In/Out] Fraction of the line of the closest hit so far (Eg.: Of a sphere or box)
+     * @param fn           `bool(uint16 triIdx, float& maxTouchDist)` - Process the triangle (Eg.: Using `CCollision::ProcessLineTriangle`), return if it was hit
+     */
+    template<typename Fn>
+    void ProcessLine(const CColLine& line, float& maxTouchDist, Fn&& fn) const {
+        const auto origin = line.m_vecStart;
+        const auto invDir = GetInvDir(line.m_vecEnd - line.m_vecStart);
+
+        uint32 hitTri{};
+        bool   isTriHit{};
+        Traverse(
+            [&](const Node& node, float& tEnter) {
+                return IsLineInBox(node, origin, invDir, std::min(maxTouchDist, 1.f), tEnter);
+            },
+            [&] { return maxTouchDist; },
+            [&](const ColTrianglePack& pack) {
+                return ProcessPack(
+                    pack,
+                    [&] { return pack.GetLineCandidates(line, std::nextafter(maxTouchDist, FLT_MAX)); },
+                    false,
+                    [&](uint16 triIdx) {
+                        // Brute-force would've hit this triangle first at the same distance, so `<=` instead of `<`
+                        auto touchDist = isTriHit && triIdx < hitTri
+                            ? std::nextafter(maxTouchDist, FLT_MAX)
+                            : maxTouchDist;
+                        if (!fn(triIdx, touchDist)) {
+                            return false;
+                        }
+                        maxTouchDist = touchDist;
+                        hitTri       = triIdx;
+                        isTriHit     = true;
+                        return true;
+                    }
+                );
+            }
+        );
+    }
+
+    /*!
+     * @brief Test the triangles the line may hit until one is hit
+     * @param fn `bool(uint16 triIdx)` - Test the triangle, return if it was hit
+     * @return Whenever a triangle was hit
+     */
+    template<typename Fn>
+    bool TestLine(const CColLine& line, Fn&& fn) const {
+        const auto origin = line.m_vecStart;
+        const auto invDir = GetInvDir(line.m_vecEnd - line.m_vecStart);
+
+        bool isHit{};
+        Traverse(
+            [&](const Node& node, float& tEnter) {
+                return IsLineInBox(node, origin, invDir, 1.f, tEnter);
+            },
+            [] { return FLT_MAX; },
+            [&](const ColTrianglePack& pack) {
+                return ProcessPack(pack, [&] { return pack.GetLineCandidates(line); }, true, [&](uint16 triIdx) { return isHit = fn(triIdx); });
+            }
+        );
+        return isHit;
+    }
+
+    /*!
+     * @brief Test the triangles the sphere may touch until one is hit
+     * @param fn `bool(uint16 triIdx)` - Test the triangle (Eg.: Using `CCollision::TestSphereTriangle`), return if it was hit
+     * @return Whenever a triangle was hit
+     */
+    template<typename Fn>
+    bool TestSphere(const CColSphere& sphere, Fn&& fn) const {
+        const CVector r{ sphere.m_fRadius, sphere.m_fRadius, sphere.m_fRadius };
+        const auto    box = ToFixedBox(CBox{ sphere.m_vecCenter - r, sphere.m_vecCenter + r });
+
+        bool isHit{};
+        Traverse(
+            [&](const Node& node, float&) { return IsBoxInBox(node, box); },
+            [] { return FLT_MAX; },
+            [&](const ColTrianglePack& pack) {
+                return ProcessPack(pack, [&] { return pack.GetSphereCandidates(sphere); }, true, [&](uint16 triIdx) { return isHit = fn(triIdx); });
+            }
+        );
+        return isHit;
+    }
+
+    /*!
+     * @brief Get the triangles that may intersect the box
+     * @param out Indices of the triangles, in ascending order (So they can be processed in the same order as a brute-force loop would)
+     */
+    void GetTrianglesInBox(const CBox& box, std::vector<uint16>& out) const;
+
+    auto GetNodes() const { return std::span{ m_Nodes }; }
+
+private:
+    //! Box in 1/128 units (See `ToFixedBox`)
+    struct FixedBox {
+        int32 Min[3]{}, Max[3]{};
+    };
+
+    //! Whenever SIMD is used for the packs, see `g_CollisionConfig`
+    enum class SIMDMode {
+        DISABLED, //!< All triangles of the leaves are tested
+        ENABLED,  //!< Only the candidates are tested
+        VALIDATE, //!< All triangles of the leaves are tested, and it's checked that the hit ones were candidates
+    };
+
+    /*!
+     * @brief Call `packFn(pack)` for the packs of all leaves for which `nodeFn(node, key)` is true - Stops once `packFn` returns false
+     * @param maxKeyFn Nodes are processed in order of their key (Lowest first), and skipped if their key is above `maxKeyFn()` by the time they'd be processed
+     */
+    template<typename NodeFn, typename MaxKeyFn, typename PackFn>
+    void Traverse(NodeFn&& nodeFn, MaxKeyFn&& maxKeyFn, PackFn&& packFn) const {
+        s_Stats.NumQueries++;
+
+        struct Entry {
+            uint16 Node;
+            float  Key;
+        };
+        Entry  stack[MAX_DEPTH * 2];
+        uint32 stackSize{};
+
+        if (float key{}; nodeFn(m_Nodes[0], key)) {
+            stack[stackSize++] = { 0, key };
+        }
+        while (stackSize) {
+            const auto entry = stack[--stackSize];
+            if (entry.Key > maxKeyFn()) {
+                continue;
+            }
+
+            const auto& node = m_Nodes[entry.Node];
+            if (node.NumTris) {
+                if (!packFn(m_Packs[node.Index])) {
+                    return;
+                }
+                continue;
+            }
+
+            Entry      a{ node.Index }, b{ (uint16)(node.Index + 1) };
+            const auto isA = nodeFn(m_Nodes[a.Node], a.Key);
+            const auto isB = nodeFn(m_Nodes[b.Node], b.Key);
+            assert(stackSize + 2 <= std::size(stack));
+            if (isA && isB) { // Push the farther first, so the closer one is processed first
+                if (a.Key <= b.Key) {
+                    stack[stackSize++] = b;
+                    stack[stackSize++] = a;
+                } else {
+                    stack[stackSize++] = a;
+                    stack[stackSize++] = b;
+                }
+            } else if (isA) {
+                stack[stackSize++] = a;
+            } else if (isB) {
+                stack[stackSize++] = b;
+            }
+        }
+    }
+
+    /*!
+     * @brief Call `fn(triIdx)` for the candidates of the pack (`maskFn()`), in order.
+     * @param stopOnHit Whenever to stop once `fn` returns true
+     * @param fn        `bool(uint16 triIdx)` - Test the triangle, return if it was hit
+     * @return False if stopped by a hit, true otherwise
+     */
+    template<typename MaskFn, typename Fn>
+    static bool ProcessPack(const ColTrianglePack& pack, MaskFn&& maskFn, bool stopOnHit, Fn&& fn) {
+        const auto mode = GetSIMDMode();
+        const auto mask = mode == SIMDMode::DISABLED ? pack.GetAllMask() : maskFn();
+        for (auto lane = 0u; lane < pack.NumTris; lane++) {
+            const auto isCandidate = (mask & (1u << lane)) != 0;
+            if (!isCandidate && mode != SIMDMode::VALIDATE) {
+                s_Stats.NumTrisCulled++;
+                continue;
+            }
+            s_Stats.NumTrisTested++;
+            if (!fn(pack.Tris[lane])) {
+                continue;
+            }
+            if (!isCandidate) {
+                OnSIMDMiss(pack.Tris[lane]);
+            }
+            if (stopOnHit) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    static SIMDMode GetSIMDMode();
+
+    //! A triangle was hit that wasn't a candidate (So the kernel is wrong)
+    static void OnSIMDMiss(uint16 triIdx);
+
+    //! Convert the box to 1/128 units (Rounded outwards)
+    static FixedBox ToFixedBox(const CBox& box);
+
+    static bool IsBoxInBox(const Node& node, const FixedBox& box) {
+        return node.Min.x.GetCompressed() <= box.Max[0] && node.Max.x.GetCompressed() >= box.Min[0]
+            && node.Min.y.GetCompressed() <= box.Max[1] && node.Max.y.GetCompressed() >= box.Min[1]
+            && node.Min.z.GetCompressed() <= box.Max[2] && node.Max.z.GetCompressed() >= box.Min[2];
+    }
+
+    //! Slab test of the line against the node's box - `tEnter` is set to the fraction of the line at which it enters the box
+    static bool IsLineInBox(const Node& node, const CVector& origin, const CVector& invDir, float maxT, float& tEnter) {
+        const CVector min = node.Min, max = node.Max;
+
+        auto tMin = 0.f, tMax = maxT;
+        for (auto i = 0; i < 3; i++) {
+            auto t0 = (min[i] - origin[i]) * invDir[i],
+                 t1 = (max[i] - origin[i]) * invDir[i];
+            if (t0 > t1) {
+                std::swap(t0, t1);
+            }
+            tMin = std::max(tMin, t0);
+            tMax = std::min(tMax, t1);
+        }
+        tEnter = tMin;
+        return tMin <= tMax;
+    }
+
+    //! `1 / dir` (Components that are 0 are `FLT_MAX` instead, so that points on the box's sides give 0, not NaN)
+    static CVector GetInvDir(const CVector& dir) {
+        return {
+            dir.x != 0.f ? 1.f / dir.x : FLT_MAX,
+            dir.y != 0.f ? 1.f / dir.y : FLT_MAX,
+            dir.z != 0.f ? 1.f / dir.z : FLT_MAX,
+        };
+    }
+
+    struct TriBounds;
+    void BuildNode(const CCollisionData& cd, std::vector<uint16>& tris, const std::vector<TriBounds>& bounds, uint16 nodeIdx, uint16 first, uint16 num);
+
+    uint32 GetNumBytes() const { return m_Nodes.capacity() * sizeof(Node) + m_Packs.capacity() * sizeof(ColTrianglePack); }
+
+private:
+    std::vector<Node>            m_Nodes{}; //!< Root is the first
+    std::vector<ColTrianglePack> m_Packs{}; //!< Triangles of the leaves
+
+    //! What the tree was built from - If the col data doesn't match anymore it was changed/freed (and maybe reallocated at the same address) without calling `Remove` (See `Get`)
+    struct Identity {
+        const CColTriangle*     Triangles{};
+        const CompressedVector* Vertices{};
+        uint16                  NumTris{};
+        uint32                  Hash{}; //!< Of the first, middle and last triangles and their vertices (See `GetIdentity`)
+
+        bool operator==(const Identity&) const = default;
+    };
+    static Identity GetIdentity(const CCollisionData& cd);
+
+    Identity m_Identity{};
+
+    static inline Stats s_Stats{};
+};
+}; // namespace notsa
@@ -0,0 +1,181 @@
+#include "StdInc.h"
+
+#include "ColTrianglePack.h"
+
+#include <emmintrin.h>
+
+#include "ColLine.h"
+#include "ColSphere.h"
+#include "ColTrianglePlane.h"
+#include "CollisionData.h"
+
+namespace notsa {
+namespace {
+//! [Units] Absolute tolerance of the kernels - Much bigger than the rounding errors of the scalar functions, as col models are at most a few hundred units big
+constexpr float EPSILON = 1.f / 1024.f;
+
+//! Relative tolerance of the sphere kernel's comparisons
+constexpr float EPSILON_REL = 1e-3f;
+
+NOTSA_FORCEINLINE __m128 Abs(__m128 v) {
+    return _mm_andnot_ps(_mm_set1_ps(-0.f), v);
+}
+
+NOTSA_FORCEINLINE __m128 Dot(__m128 ax, __m128 ay, __m128 az, __m128 bx, __m128 by, __m128 bz) {
+    return _mm_add_ps(_mm_add_ps(_mm_mul_ps(ax, bx), _mm_mul_ps(ay, by)), _mm_mul_ps(az, bz));
+}
+
+//! `mask ? a : b`
+NOTSA_FORCEINLINE __m128 Select(__m128 mask, __m128 a, __m128 b) {
+    return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+}
+
+//! `x > y + tol`
+NOTSA_FORCEINLINE __m128 IsGreater(__m128 x, __m128 y, __m128 tol) {
+    return _mm_cmpgt_ps(x, _mm_add_ps(y, tol));
+}
+
+//! 3 lanes of vectors
+struct Vec4 {
+    __m128 x, y, z;
+
+    static Vec4 Load(const float* xs, const float* ys, const float* zs) { return { _mm_load_ps(xs), _mm_load_ps(ys), _mm_load_ps(zs) }; }
+    static Vec4 Splat(const CVector& v) { return { _mm_set1_ps(v.x), _mm_set1_ps(v.y), _mm_set1_ps(v.z) }; }
+
+    Vec4   operator+(const Vec4& o) const { return { _mm_add_ps(x, o.x), _mm_add_ps(y, o.y), _mm_add_ps(z, o.z) }; }
+    Vec4   operator-(const Vec4& o) const { return { _mm_sub_ps(x, o.x), _mm_sub_ps(y, o.y), _mm_sub_ps(z, o.z) }; }
+    Vec4   operator*(__m128 s) const { return { _mm_mul_ps(x, s), _mm_mul_ps(y, s), _mm_mul_ps(z, s) }; }
+    __m128 Dot(const Vec4& o) const { return notsa::Dot(x, y, z, o.x, o.y, o.z); }
+};
+};
+
+void ColTrianglePack::Set(const CCollisionData& cd, std::span<const uint16> tris) {
+    assert(!tris.empty() && tris.size() <= SIZE);
+
+    NumTris = (uint16)tris.size();
+    for (auto lane = 0u; lane < SIZE; lane++) {
+        const auto    triIdx = tris[lane < tris.size() ? lane : 0];
+        const auto&   tri    = cd.m_pTriangles[triIdx];
+        const CVector a = cd.m_pVertices[tri.vA], b = cd.m_pVertices[tri.vB], c = cd.m_pVertices[tri.vC];
+
+        Tris[lane] = triIdx;
+
+        Ax[lane] = a.x; Ay[lane] = a.y; Az[lane] = a.z;
+        Bx[lane] = b.x; By[lane] = b.y; Bz[lane] = b.z;
+        Cx[lane] = c.x; Cy[lane] = c.y; Cz[lane] = c.z;
+
+        // Same as what `CCollision::CalculateTrianglePlanes` calculates
+        const CColTrianglePlane plane{ tri, cd.m_pVertices };
+        const auto              n = plane.GetNormal();
+
+        Nx[lane]      = n.x;
+        Ny[lane]      = n.y;
+        Nz[lane]      = n.z;
+        NOffset[lane] = plane.m_normalOffset;
+
+        Axis[lane]    = (int32)plane.m_orientation / 2;
+        Winding[lane] = (int32)plane.m_orientation % 2 ? 1.f : -1.f;
+    }
+}
+
+// Same steps as `ProcessLineTriangle_Internal` (See Collision.cpp) - The tolerances are there to make sure a triangle is never rejected by rounding errors
+uint32 ColTrianglePack::GetLineCandidates(const CColLine& line, float maxTouchDist) const {
+    const auto dir    = line.m_vecEnd - line.m_vecStart;
+    const auto dirLen = std::abs(dir.x) + std::abs(dir.y) + std::abs(dir.z); // Overestimated, that's fine
+
+    const auto start = Vec4::Splat(line.m_vecStart), end = Vec4::Splat(line.m_vecEnd);
+    const auto n     = Vec4::Load(Nx, Ny, Nz);
+    const auto nOffs = _mm_load_ps(NOffset);
+    const auto eps   = _mm_set1_ps(EPSILON);
+
+    // Both points are on the same side of the plane
+    const auto d0 = _mm_sub_ps(start.Dot(n), nOffs);
+    const auto d1 = _mm_sub_ps(end.Dot(n), nOffs);
+    auto isRejected = _mm_or_ps(
+        _mm_and_ps(_mm_cmpgt_ps(d0, eps), _mm_cmpgt_ps(d1, eps)),
+        _mm_and_ps(_mm_cmplt_ps(d0, _mm_sub_ps(_mm_setzero_ps(), eps)), _mm_cmplt_ps(d1, _mm_sub_ps(_mm_setzero_ps(), eps)))
+    );
+
+    // The intersection is farther than the closest hit so far
+    // The closer the line is to being parallel to the plane the bigger the error of `t` is (If they're parallel it's inf/NaN, and the triangle is kept)
+    const auto plLnMag = _mm_sub_ps(_mm_setzero_ps(), Vec4::Splat(dir).Dot(n));
+    const auto t       = _mm_div_ps(d0, plLnMag);
+    const auto tErr    = _mm_div_ps(eps, Abs(plLnMag));
+    isRejected = _mm_or_ps(isRejected, _mm_cmpge_ps(_mm_sub_ps(t, tErr), _mm_set1_ps(maxTouchDist)));
+
+    // Intersection point - `lerp(start, end, t)`
+    const auto ip    = end * t + start * _mm_sub_ps(_mm_set1_ps(1.f), t);
+    const auto ipErr = _mm_add_ps(eps, _mm_mul_ps(tErr, _mm_set1_ps(dirLen)));
+
+    // Project everything to 2D along the plane's axis
+    const auto axis = _mm_load_si128(reinterpret_cast<const __m128i*>(Axis));
+    const auto isX  = _mm_castsi128_ps(_mm_cmpeq_epi32(axis, _mm_setzero_si128()));
+    const auto isY  = _mm_castsi128_ps(_mm_cmpeq_epi32(axis, _mm_set1_epi32(1)));
+    const auto ToU  = [&](const Vec4& v) { return Select(isX, v.y, Select(isY, v.z, v.x)); };
+    const auto ToV  = [&](const Vec4& v) { return Select(isX, v.z, Select(isY, v.x, v.y)); };
+
+    const auto a = Vec4::Load(Ax, Ay, Az), b = Vec4::Load(Bx, By, Bz), c = Vec4::Load(Cx, Cy, Cz);
+    const auto au = ToU(a), av = ToV(a), bu = ToU(b), bv = ToV(b), cu = ToU(c), cv = ToV(c), ipu = ToU(ip), ipv = ToV(ip);
+
+    // Whenever the point is on the wrong side of the edge (`CVector2D::Cross`) - It should be on the positive side (Or on the negative if `isNeg`)
+    // The side is multiplied by the winding, so it's the same for both orientations
+    const auto winding = _mm_load_ps(Winding);
+    const auto IsOutside = [&](__m128 eu, __m128 ev, __m128 pu, __m128 pv, bool isNeg) {
+        const auto side = _mm_mul_ps(winding, _mm_sub_ps(_mm_mul_ps(eu, pv), _mm_mul_ps(ev, pu)));
+        const auto tol  = _mm_mul_ps(ipErr, _mm_add_ps(Abs(eu), Abs(ev)));
+        return isNeg
+            ? _mm_cmpgt_ps(side, tol)
+            : _mm_cmplt_ps(side, _mm_sub_ps(_mm_setzero_ps(), tol));
+    };
+    const auto ipau = _mm_sub_ps(ipu, au), ipav = _mm_sub_ps(ipv, av);
+    isRejected = _mm_or_ps(isRejected, IsOutside(_mm_sub_ps(bu, au), _mm_sub_ps(bv, av), ipau, ipav, false));
+    isRejected = _mm_or_ps(isRejected, IsOutside(_mm_sub_ps(cu, au), _mm_sub_ps(cv, av), ipau, ipav, true));
+    isRejected = _mm_or_ps(isRejected, IsOutside(_mm_sub_ps(cu, bu), _mm_sub_ps(cv, bv), _mm_sub_ps(ipu, bu), _mm_sub_ps(ipv, bv), false));
+
+    return ~(uint32)_mm_movemask_ps(isRejected) & GetAllMask();
+}
+
+// Same steps as `CCollision::TestSphereTriangle`, with each test relaxed by a tolerance relative to the size of the triangle and sphere
+uint32 ColTrianglePack::GetSphereCandidates(const CColSphere& sphere) const {
+    const auto P  = Vec4::Splat(sphere.m_vecCenter);
+    const auto r  = _mm_set1_ps(sphere.m_fRadius);
+    const auto rr = _mm_mul_ps(r, r);
+
+    const auto A = Vec4::Load(Ax, Ay, Az) - P;
+    const auto B = Vec4::Load(Bx, By, Bz) - P;
+    const auto C = Vec4::Load(Cx, Cy, Cz) - P;
+    const auto N = Vec4::Load(Nx, Ny, Nz);
+
+    const auto aa = A.Dot(A), ab = A.Dot(B), ac = A.Dot(C);
+    const auto bb = B.Dot(B), bc = B.Dot(C), cc = C.Dot(C);
+
+    // Bound of the squared length of the edges, the tolerances are relative to it
+    const auto maxSq = _mm_mul_ps(_mm_set1_ps(4.f), _mm_max_ps(_mm_max_ps(aa, bb), _mm_max_ps(cc, rr)));
+    const auto tol2  = _mm_mul_ps(_mm_set1_ps(EPSILON_REL), maxSq);
+    const auto tol6  = _mm_mul_ps(tol2, _mm_mul_ps(maxSq, maxSq));
+
+    const auto s1 = IsGreater(Abs(A.Dot(N)), r, _mm_set1_ps(EPSILON));
+    const auto s2 = _mm_and_ps(IsGreater(aa, rr, tol2), _mm_and_ps(IsGreater(ab, aa, tol2), IsGreater(ac, aa, tol2)));
+    const auto s3 = _mm_and_ps(IsGreater(bb, rr, tol2), _mm_and_ps(IsGreater(ab, bb, tol2), IsGreater(bc, bb, tol2)));
+    const auto s4 = _mm_and_ps(IsGreater(cc, rr, tol2), _mm_and_ps(IsGreater(ac, cc, tol2), IsGreater(bc, cc, tol2)));
+
+    const auto AB = B - A, BC = C - B, CA = A - C;
+    const auto d1 = _mm_sub_ps(ab, aa), d2 = _mm_sub_ps(bc, bb), d3 = _mm_sub_ps(ac, cc);
+    const auto e1 = AB.Dot(AB), e2 = BC.Dot(BC), e3 = CA.Dot(CA);
+    const auto Q1 = A * e1 - AB * d1;
+    const auto Q2 = B * e2 - BC * d2;
+    const auto Q3 = C * e3 - CA * d3;
+    const auto QC = C * e1 - Q1;
+    const auto QA = A * e2 - Q2;
+    const auto QB = B * e3 - Q3;
+    const auto IsEdgeSeparating = [&](const Vec4& Q, const Vec4& Qo, __m128 e) {
+        return _mm_and_ps(IsGreater(Q.Dot(Q), _mm_mul_ps(rr, _mm_mul_ps(e, e)), tol6), IsGreater(Q.Dot(Qo), _mm_setzero_ps(), tol6));
+    };
+    const auto s5 = IsEdgeSeparating(Q1, QC, e1);
+    const auto s6 = IsEdgeSeparating(Q2, QA, e2);
+    const auto s7 = IsEdgeSeparating(Q3, QB, e3);
+
+    const auto isRejected = _mm_or_ps(_mm_or_ps(_mm_or_ps(s1, s2), _mm_or_ps(s3, s4)), _mm_or_ps(s5, _mm_or_ps(s6, s7)));
+    return ~(uint32)_mm_movemask_ps(isRejected) & GetAllMask();
+}
+}; // namespace notsa
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <cfloat>
+#include <span>
+
+#include "Vector.h"
+
+class CCollisionData;
+class CColLine;
+class CColSphere;
+
+namespace notsa {
+/*!
+ * @brief NOTSA: Up to 4 triangles of a col model (Vertices and planes) decompressed into SoA form, so that a line or sphere can be tested against all of them at once with SSE.
+ *
+ * `CCollision::ProcessLineTriangle` and `CCollision::TestSphereTriangle` test one triangle per call, decompressing its vertices (and plane) every time.
+ * The kernels here (`GetLineCandidates`, `GetSphereCandidates`) do the same math for 4 triangles, but only to find the triangles that *may* be hit:
+ * They use a small tolerance everywhere, so they never reject a triangle the scalar function would hit (Even if the rounding is a bit different),
+ * and the candidates are then processed by the scalar function, so the results are exactly the same as without them.
+ * (See `ColTriangleBVH`, whose leaves are packs, and `g_CollisionConfig.ValidateTriangleSIMD` to check the above)
+ */
+struct alignas(16) ColTrianglePack {
+    static constexpr uint32 SIZE = 4;
+
+    //! Set the triangles of the pack (At most `SIZE`)
+    void Set(const CCollisionData& cd, std::span<const uint16> tris);
+
+    //! Bitmask of the triangles `CCollision::ProcessLineTriangle` (or `TestLineTriangle`) may hit [with `maxTouchDist`]
+    uint32 GetLineCandidates(const CColLine& line, float maxTouchDist = FLT_MAX) const;
+
+    //! Bitmask of the triangles `CCollision::TestSphereTriangle` may hit
+    uint32 GetSphereCandidates(const CColSphere& sphere) const;
+
+    //! Bitmask of all triangles in the pack
+    uint32 GetAllMask() const { return (1u << NumTris) - 1u; }
+
+    // Vertices (Unused lanes are a copy of the 1st triangle)
+    float Ax[SIZE]{}, Ay[SIZE]{}, Az[SIZE]{};
+    float Bx[SIZE]{}, By[SIZE]{}, Bz[SIZE]{};
+    float Cx[SIZE]{}, Cy[SIZE]{}, Cz[SIZE]{};
+
+    // Planes (Same values as `CColTrianglePlane`'s, as that's what the scalar functions use)
+    float Nx[SIZE]{}, Ny[SIZE]{}, Nz[SIZE]{};
+    float NOffset[SIZE]{};
+
+    // 2D projection used by the line test (From `CColTrianglePlane::m_orientation`)
+    int32 Axis[SIZE]{};    //!< Axis the triangle is projected along (0 - X, 1 - Y, 2 - Z)
+    float Winding[SIZE]{}; //!< 1 if the orientation is negative, -1 if positive (As for those the scalar function swaps `B` and `C`)
+
+    uint16 Tris[SIZE]{}; //!< Index of the triangles in the col data
+    uint16 NumTris{};
+};
+}; // namespace notsa
@@ -12,6 +12,7 @@
 
 #include "Collision.h"
 #include "ColHelpers.h"
+#include "ColTriangleBVH.h"
 #include "PedModelInfo.h"
 #include "TaskSimpleHoldEntity.h"
 
@@ -42,6 +43,7 @@ void CCollision::Shutdown() {
     }
     ms_colModelCache.Shutdown();
     CColStore::Shutdown();
+    notsa::ColTriangleBVH::RemoveAll(); // NOTSA
 }
 
 // 0x411E20
@@ -1697,6 +1699,12 @@ bool CCollision::TestLineOfSight(
     CalculateTrianglePlanes(cd);
     const auto verts = cd->GetTriVerts();
     const auto pls   = cd->GetTriPlanes();
+    if (const auto bvh = notsa::ColTriangleBVH::Get(*cd)) { // NOTSA: Only test the triangles near the line
+        return bvh->TestLine(lnos, [&](uint16 idx) {
+            const auto& tri = cd->m_pTriangles[idx];
+            return ShouldTest(tri.GetSurfaceType()) && TestLineTriangle(lnos, verts, tri, pls[idx]);
+        });
+    }
     for (const auto&& [idx, tri] : rngv::enumerate(cd->GetTris())) { // TODO: rng::zip
         if (ShouldTest(tri.GetSurfaceType()) && TestLineTriangle(lnos, verts, tri, pls[idx])) {
             return true;
@@ -1750,10 +1758,18 @@ bool CCollision::ProcessLineOfSight(const CColLine& lnws, const CMatrix& transfo
 
     CalculateTrianglePlanes(colData);
 
-    for (auto i = 0; i < colData->m_nNumTriangles; i++) {
+    const auto ProcessTri = [&](uint16 i, float& touchDist) {
         if (const auto& tri = colData->m_pTriangles[i]; CheckSeeAndShootThrough(tri.m_nMaterial)) {
-            results |= ProcessLineTriangle(line_OS, colData->m_pVertices, tri, colData->m_pTrianglePlanes[i], colPoint, localMinTouchDist, nullptr);
             ms_iProcessLineNumCrossings++;
+            return ProcessLineTriangle(line_OS, colData->m_pVertices, tri, colData->m_pTrianglePlanes[i], colPoint, touchDist, nullptr);
+        }
+        return false;
+    };
+    if (const auto bvh = notsa::ColTriangleBVH::Get(*colData)) { // NOTSA: Only process the triangles near the line
+        bvh->ProcessLine(line_OS, localMinTouchDist, ProcessTri);
+    } else {
+        for (auto i = 0; i < colData->m_nNumTriangles; i++) {
+            ProcessTri((uint16)i, localMinTouchDist);
         }
     }
 
@@ -1821,9 +1837,16 @@ bool CCollision::ProcessVerticalLine(
     CStoredCollPoly storedColPoly{};
     const auto verts = cd->GetTriVerts();
     const auto pls   = cd->GetTriPlanes();
-    for (const auto&& [idx, tri] : rngv::enumerate(cd->GetTris())) { // TODO: rng::zip
-        if (ShouldTest(tri.GetSurfaceType())) {
-            ProcessLineTriangle(lnos, verts, tri, pls[idx], cp, localMaxTouchDist, &storedColPoly);
+    const auto ProcessTri = [&](uint16 idx, float& touchDist) {
+        const auto& tri = cd->m_pTriangles[idx];
+        return ShouldTest(tri.GetSurfaceType())
+            && ProcessLineTriangle(lnos, verts, tri, pls[idx], cp, touchDist, &storedColPoly);
+    };
+    if (const auto bvh = notsa::ColTriangleBVH::Get(*cd)) { // NOTSA: Only process the triangles near the line
+        bvh->ProcessLine(lnos, localMaxTouchDist, ProcessTri);
+    } else {
+        for (auto idx = 0; idx < cd->m_nNumTriangles; idx++) {
+            ProcessTri((uint16)idx, localMaxTouchDist);
         }
     }
 
@@ -2850,7 +2873,23 @@ bool CCollision::SphereCastVsEntity(
             return false;
         };
 
-        if (ecd->bHasFaceGroups) {
+        if (const auto bvh = notsa::ColTriangleBVH::Get(*ecd)) { // NOTSA: Only process the triangles near the path of the sphere
+            static std::vector<uint16> s_TriIdxs{};
+            // Same as `GetBoundingBoxFromTwoSpheres`, but using the bigger radius, as the spheres are also tested the other way around (See `gbTryDoubleSidedCollision`)
+            const auto radius = std::max(spAos.m_fRadius, spBos.m_fRadius);
+            CBox       bb{};
+            for (auto i = 0u; i < 3u; i++) {
+                std::tie(bb.m_vecMin[i], bb.m_vecMax[i]) = std::minmax(spAos.m_vecCenter[i], spBos.m_vecCenter[i]);
+                bb.m_vecMin[i] -= radius;
+                bb.m_vecMax[i] += radius;
+            }
+            bvh->GetTrianglesInBox(bb, s_TriIdxs);
+            for (const auto triIdx : s_TriIdxs) {
+                if (ProcessTri(triIdx)) {
+                    return true;
+                }
+            }
+        } else if (ecd->bHasFaceGroups) {
             for (const auto& fg : ecd->GetFaceGroups()) {
                 if (!SphereCastVsBBox(spAos, spBos, fg.bb)) {
                     continue;
@@ -3560,6 +3599,147 @@ void CCollision::Tests(int32 i) {
 
 #endif
 
+    // NOTSA: `notsa::ColTriangleBVH` - Must give the same results as testing all triangles
+    {
+        // Random triangles, some duplicated (With a different surface), so that there are hits at the same distance
+        std::vector<CompressedVector> verts{};
+        std::vector<CColTriangle>     tris{};
+        for (auto t = 0u; t < 500u; t++) {
+            const auto centre = RandomVector(-50.f, 50.f);
+            const auto first  = (uint16)verts.size();
+            for (auto v = 0; v < 3; v++) {
+                verts.emplace_back(centre + RandomVector(-5.f, 5.f));
+            }
+            tris.emplace_back(first, first + 1, first + 2, (eSurfaceType)(t % 8), tColLighting{});
+            if (t % 10 == 0) {
+                tris.emplace_back(first, first + 1, first + 2, (eSurfaceType)(t % 8 + 1), tColLighting{});
+            }
+        }
+        std::vector<CColTrianglePlane> planes{};
+        for (const auto& tri : tris) {
+            planes.emplace_back(tri, verts.data());
+        }
+
+        CCollisionData cd{};
+        cd.m_nNumTriangles   = (uint16)tris.size();
+        cd.m_pVertices       = verts.data();
+        cd.m_pTriangles      = tris.data();
+        cd.m_pTrianglePlanes = planes.data();
+        const notsa::ColTriangleBVH bvh{ cd };
+
+        const auto ProcessLineCmp = [&](auto org, auto rev) {
+            const auto& [org_cp, org_d, org_s] = org;
+            const auto& [rev_cp, rev_d, rev_s] = rev;
+            return org_s == rev_s && org_d == rev_d && (!org_s || (org_cp.m_nSurfaceTypeB == rev_cp.m_nSurfaceTypeB && ColPointEq(org_cp, rev_cp)));
+        };
+        for (auto i = 0; i < 1000; i++) {
+            const auto line = i % 4 ? RandomLine(-60.f, 60.f) : RandomVerticalLine(-60.f, 60.f);
+
+            Test(
+                "ColTriangleBVH::ProcessLine",
+                [&] {
+                    CColPoint cp{};
+                    float     d{ 1.f };
+                    bool      s{};
+                    for (auto t = 0u; t < tris.size(); t++) {
+                        s |= ProcessLineTriangle(line, verts.data(), tris[t], planes[t], cp, d, nullptr);
+                    }
+                    return std::make_tuple(cp, d, s);
+                },
+                [&] {
+                    CColPoint cp{};
+                    float     d{ 1.f };
+                    bool      s{};
+                    bvh.ProcessLine(line, d, [&](uint16 t, float& touchDist) {
+                        return ProcessLineTriangle(line, verts.data(), tris[t], planes[t], cp, touchDist, nullptr);
+                    });
+                    s = d < 1.f;
+                    return std::make_tuple(cp, d, s);
+                },
+                ProcessLineCmp
+            );
+
+            Test(
+                "ColTriangleBVH::TestLine",
+                [&] {
+                    for (auto t = 0u; t < tris.size(); t++) {
+                        if (TestLineTriangle(line, verts.data(), tris[t], planes[t])) {
+                            return true;
+                        }
+                    }
+                    return false;
+                },
+                [&] {
+                    return bvh.TestLine(line, [&](uint16 t) { return TestLineTriangle(line, verts.data(), tris[t], planes[t]); });
+                },
+                std::equal_to<>{}
+            );
+
+            // All triangles touching the sphere must be in the box's list
+            const CColSphere sp{ RandomVector(-60.f, 60.f), CGeneral::GetRandomNumberInRange(1.f, 10.f) };
+            const CVector    r{ sp.m_fRadius, sp.m_fRadius, sp.m_fRadius };
+            std::vector<uint16> inBox{};
+            bvh.GetTrianglesInBox(CBox{ sp.m_vecCenter - r, sp.m_vecCenter + r }, inBox);
+            Test(
+                "ColTriangleBVH::GetTrianglesInBox",
+                [&] { return true; },
+                [&] {
+                    for (auto t = 0u; t < tris.size(); t++) {
+                        if (TestSphereTriangle(sp, verts.data(), tris[t], planes[t]) && !rng::binary_search(inBox, (uint16)t)) {
+                            return false;
+                        }
+                    }
+                    return true;
+                },
+                std::equal_to<>{}
+            );
+
+            Test(
+                "ColTriangleBVH::TestSphere",
+                [&] {
+                    for (auto t = 0u; t < tris.size(); t++) {
+                        if (TestSphereTriangle(sp, verts.data(), tris[t], planes[t])) {
+                            return true;
+                        }
+                    }
+                    return false;
+                },
+                [&] {
+                    return bvh.TestSphere(sp, [&](uint16 t) { return TestSphereTriangle(sp, verts.data(), tris[t], planes[t]); });
+                },
+                std::equal_to<>{}
+            );
+
+            // The kernels must never cull a triangle that's hit
+            Test(
+                "ColTrianglePack",
+                [&] { return true; },
+                [&] {
+                    for (auto first = 0u; first < tris.size(); first += notsa::ColTrianglePack::SIZE) {
+                        std::array<uint16, notsa::ColTrianglePack::SIZE> idxs{};
+                        const auto num = std::min<size_t>(idxs.size(), tris.size() - first);
+                        std::iota(idxs.begin(), idxs.begin() + num, (uint16)first);
+
+                        notsa::ColTrianglePack pack{};
+                        pack.Set(cd, std::span{ idxs }.first(num));
+                        const auto lineMask = pack.GetLineCandidates(line), sphereMask = pack.GetSphereCandidates(sp);
+                        for (auto lane = 0u; lane < num; lane++) {
+                            const auto t = first + lane;
+                            if (TestLineTriangle(line, verts.data(), tris[t], planes[t]) && !(lineMask & (1u << lane))) {
+                                return false;
+                            }
+                            if (TestSphereTriangle(sp, verts.data(), tris[t], planes[t]) && !(sphereMask & (1u << lane))) {
+                                return false;
+                            }
+                        }
+                    }
+                    return true;
+                },
+                std::equal_to<>{}
+            );
+        }
+    }
+
     // ProcessLineBox
     /*{
         const auto Org = [&](auto line, auto bb) {
@@ -2,14 +2,15 @@
 
 #include "CollisionData.h"
 #include "ColHelpers.h"
+#include "ColTriangleBVH.h"
 
 void CCollisionData::InjectHooks() {
     RH_ScopedClass(CCollisionData);
     RH_ScopedCategory("Collision");
 
-    RH_ScopedInstall(RemoveCollisionVolumes, 0x40F070);
+    RH_ScopedInstall(RemoveCollisionVolumes, 0x40F070, {.locked = true}); // Locked because of `notsa::ColTriangleBVH::Remove`
     RH_ScopedInstall(RemoveTrianglePlanes, 0x40F6A0);
-    RH_ScopedInstall(Copy, 0x40F120);
+    RH_ScopedInstall(Copy, 0x40F120, {.locked = true}); // Locked because of `notsa::ColTriangleBVH::Remove`
     RH_ScopedInstall(GetTrianglePoint, 0x40F5E0);
     RH_ScopedInstall(GetShadTrianglePoint, 0x40F640);
     RH_ScopedInstall(CalculateTrianglePlanes, 0x40F590);
@@ -46,6 +47,8 @@ CCollisionData::CCollisionData() {
 
 // 0x40F070
 void CCollisionData::RemoveCollisionVolumes() {
+    notsa::ColTriangleBVH::Remove(*this); // NOTSA
+
     CMemoryMgr::Free(m_pSpheres);
     CMemoryMgr::Free(m_pLines);
     CMemoryMgr::Free(m_pBoxes);
@@ -72,6 +75,7 @@ void CCollisionData::RemoveCollisionVolumes() {
 // 0x40F120
 void CCollisionData::Copy(const CCollisionData& src) {
     assert(!bHasFaceGroups); // Avoid possible random bugs - See header for more info.
+    notsa::ColTriangleBVH::Remove(*this); // NOTSA: The triangles are about to change
 
     // ----- SPHERES -----
     if (m_nNumSpheres != src.m_nNumSpheres || !src.m_nNumSpheres) {
@@ -0,0 +1,170 @@
+#include "StdInc.h"
+
+#include "ContactCache.h"
+
+#include "extensions/Configs/Collision.hpp"
+
+namespace notsa {
+int32 ContactCache::ProcessColModels(
+    const CEntity& entityA, const CMatrix& transformA, CColModel& cmA,
+    const CEntity& entityB, const CMatrix& transformB, CColModel& cmB,
+    std::array<CColPoint, 32>& sphereCPs,
+    CColPoint* lineCPs,
+    float* maxTouchDistances
+) {
+    ZoneScoped;
+
+    const auto cdA = cmA.m_pColData, cdB = cmB.m_pColData;
+    if (!g_CollisionConfig.ContactCache || !cdA || !cdB || cdA->m_nNumLines > MAX_LINES || cdA->m_nNumLines && (!lineCPs || !maxTouchDistances)) {
+        return CCollision::ProcessColModels(transformA, cmA, transformB, cmB, sphereCPs, lineCPs, maxTouchDistances, false);
+    }
+
+    s_Stats.NumQueries++;
+
+    const auto aToB = transformB.Inverted() * transformA;
+    auto&      e    = s_Entries[Key{ &entityA, &entityB, cdA->m_nNumTriangles, cdB->m_nNumTriangles, cdA->m_nNumLines }];
+    e.FrameUsed     = CTimer::GetFrameCounter();
+    if (CanReuse(e, aToB, cmA, cmB)) {
+        s_Stats.NumReused++;
+        return Reuse(e, aToB, transformB, *cdA, sphereCPs, lineCPs, maxTouchDistances);
+    }
+
+    // Find all the lines' contacts (Not just the ones closer than `maxTouchDistances`), so they can be reused whatever the caller's distances are
+    std::array<CColPoint, MAX_LINES> allLineCPs{};
+    std::array<float, MAX_LINES>     allTouchDists{};
+    allTouchDists.fill(1.f);
+
+    const auto numSphereCPs = CCollision::ProcessColModels(transformA, cmA, transformB, cmB, sphereCPs, allLineCPs.data(), allTouchDists.data(), false);
+    Store(e, aToB, transformB, cmA, cmB, sphereCPs, numSphereCPs, allLineCPs.data(), allTouchDists.data(), cdA->m_nNumLines);
+
+    // Same as what `ProcessColModels` would've returned for the caller's distances (It keeps the closest contact of each line)
+    for (auto i = 0u; i < cdA->m_nNumLines; i++) {
+        if (allTouchDists[i] < maxTouchDistances[i]) {
+            maxTouchDistances[i] = allTouchDists[i];
+            lineCPs[i]           = allLineCPs[i];
+        }
+    }
+    s_Stats.NumEntries = (uint32)s_Entries.size();
+
+    return numSphereCPs;
+}
+
+bool ContactCache::CanReuse(const Entry& e, const CMatrix& aToB, const CColModel& cmA, const CColModel& cmB) {
+    if (e.ColModelA != &cmA || e.ColModelB != &cmB || CTimer::GetFrameCounter() - e.FrameFound > g_CollisionConfig.ContactCacheMaxFrames) {
+        return false;
+    }
+
+    const auto maxMove = g_CollisionConfig.ContactCacheMaxMove,
+               maxTurn = g_CollisionConfig.ContactCacheMaxTurn;
+    return CVector::DistSqr(aToB.GetPosition(), e.AToB.GetPosition()) <= sq(maxMove)
+        && CVector::DistSqr(aToB.GetRight(), e.AToB.GetRight()) <= sq(maxTurn)
+        && CVector::DistSqr(aToB.GetForward(), e.AToB.GetForward()) <= sq(maxTurn)
+        && CVector::DistSqr(aToB.GetUp(), e.AToB.GetUp()) <= sq(maxTurn);
+}
+
+void ContactCache::Store(Entry& e, const CMatrix& aToB, const CMatrix& transformB, CColModel& cmA, CColModel& cmB, const std::array<CColPoint, 32>& sphereCPs, int32 numSphereCPs, const CColPoint* lineCPs, const float* touchDists, uint32 numLines) {
+    e.AToB       = aToB;
+    e.ColModelA  = &cmA;
+    e.ColModelB  = &cmB;
+    e.FrameFound = CTimer::GetFrameCounter();
+
+    const auto ToSpaceB = [&](CColPoint cp) {
+        cp.m_vecPoint  = transformB.InverseTransformPoint(cp.m_vecPoint);
+        cp.m_vecNormal = transformB.InverseTransformVector(cp.m_vecNormal);
+        return cp;
+    };
+
+    e.NumSphereCPs = (uint8)numSphereCPs;
+    for (auto i = 0; i < numSphereCPs; i++) {
+        e.SphereCPs[i] = ToSpaceB(sphereCPs[i]);
+    }
+
+    e.LineTouchDists.fill(1.f);
+    for (auto i = 0u; i < numLines; i++) {
+        if (touchDists[i] < 1.f) {
+            e.LineCPs[i]        = ToSpaceB(lineCPs[i]);
+            e.LineTouchDists[i] = touchDists[i];
+        }
+    }
+}
+
+int32 ContactCache::Reuse(const Entry& e, const CMatrix& aToB, const CMatrix& transformB, const CCollisionData& cdA, std::array<CColPoint, 32>& sphereCPs, CColPoint* lineCPs, float* maxTouchDistances) {
+    // Sphere contacts move along with `A`, and get shallower by how much they moved along the normal (Which points towards `A`)
+    int32 numSphereCPs{};
+    for (const auto& cached : std::span{ e.SphereCPs }.first(e.NumSphereCPs)) {
+        const auto pt    = aToB.TransformPoint(e.AToB.InverseTransformPoint(cached.m_vecPoint));
+        const auto depth = cached.m_fDepth - (pt - cached.m_vecPoint).Dot(cached.m_vecNormal);
+        if (depth < 0.f) {
+            s_Stats.NumDropped++;
+            continue;
+        }
+        auto& cp       = sphereCPs[numSphereCPs++];
+        cp             = cached;
+        cp.m_vecPoint  = transformB.TransformPoint(pt);
+        cp.m_vecNormal = transformB.TransformVector(cached.m_vecNormal);
+        cp.m_fDepth    = depth;
+    }
+    if (numSphereCPs < (int32)sphereCPs.size()) {
+        sphereCPs[numSphereCPs].m_fDepth = -1.f; // Same as `ProcessColModels`
+    }
+
+    // Lines are intersected again with the plane of their contact
+    for (auto i = 0u; i < cdA.m_nNumLines; i++) {
+        if (e.LineTouchDists[i] >= 1.f) {
+            continue;
+        }
+        const auto& cached = e.LineCPs[i];
+        const auto& line   = cdA.m_pLines[i];
+        const auto  start  = aToB.TransformPoint(line.m_vecStart),
+                    dir    = aToB.TransformPoint(line.m_vecEnd) - start;
+        const auto  denom  = dir.Dot(cached.m_vecNormal);
+        const auto  t      = denom < 0.f ? (cached.m_vecPoint - start).Dot(cached.m_vecNormal) / denom : -1.f;
+        if (t < 0.f || t >= 1.f) {
+            s_Stats.NumDropped++;
+            continue;
+        }
+        if (t >= maxTouchDistances[i]) {
+            continue;
+        }
+        maxTouchDistances[i]   = t;
+        lineCPs[i]             = cached;
+        lineCPs[i].m_vecPoint  = transformB.TransformPoint(start + dir * t);
+        lineCPs[i].m_vecNormal = transformB.TransformVector(cached.m_vecNormal);
+    }
+
+    return numSphereCPs;
+}
+
+void ContactCache::Update() {
+    if (!g_CollisionConfig.ContactCache) {
+        Clear();
+        return;
+    }
+    const auto frame = CTimer::GetFrameCounter();
+    std::erase_if(s_Entries, [frame](const auto& kv) {
+        return frame - kv.second.FrameUsed > g_CollisionConfig.ContactCacheMaxFrames;
+    });
+    s_Stats.NumEntries = (uint32)s_Entries.size();
+}
+
+void ContactCache::Remove(const CEntity& entity) {
+    if (s_Entries.empty()) {
+        return;
+    }
+    std::erase_if(s_Entries, [&entity](const auto& kv) {
+        return kv.first.A == &entity || kv.first.B == &entity;
+    });
+    s_Stats.NumEntries = (uint32)s_Entries.size();
+}
+
+void ContactCache::Clear() {
+    s_Entries.clear();
+    s_Stats.NumEntries = 0;
+}
+
+void ContactCache::ResetStats() {
+    s_Stats.NumQueries = 0;
+    s_Stats.NumReused  = 0;
+    s_Stats.NumDropped = 0;
+}
+}; // namespace notsa
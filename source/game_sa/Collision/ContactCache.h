@@ -0,0 +1,102 @@
+#pragma once
+
+#include <array>
+#include <unordered_map>
+
+#include "Matrix.h"
+#include "ColPoint.h"
+
+class CEntity;
+class CColModel;
+class CCollisionData;
+
+namespace notsa {
+/*!
+ * @brief NOTSA: Cache of the contacts (colpoints) found between 2 entities, reused while they barely move relative to each other.
+ *
+ * `CPhysical::ProcessCollisionSectorList` calls `ProcessEntityCollision` for every entity touching the processed one,
+ * up to 5 times a frame (See `CWorld::Process`), and each call runs `CCollision::ProcessColModels` from scratch.
+ * For vehicles resting (or crawling) on the ground, that's the same wheel lines and spheres against the same triangles, with the same result, every time.
+ *
+ * The contacts are stored in the space of `B` (The entity collided with), along with where `A` was relative to `B`.
+ * As long as `A` moved less than `g_CollisionConfig.ContactCacheMaxMove` (And turned less than `ContactCacheMaxTurn`) relative to `B` since,
+ * and the contacts aren't older than `ContactCacheMaxFrames`, they're reused instead of running `ProcessColModels`:
+ * - Sphere contacts move along with `A`, and their depth is updated by how much they moved along the normal (Ones that separated are dropped)
+ * - Line contacts (Wheels) are intersected again with the plane of the contact (Ones that left the line are dropped)
+ * This is an approximation: contacts that would start within those limits are only found when the cache is refreshed.
+ */
+class ContactCache {
+public:
+    static constexpr uint32 MAX_LINES = 16; //!< Same as in `CCollision::ProcessColModels`
+
+    struct Stats {
+        uint32 NumEntries{};  //!< Number of entity pairs in the cache
+        uint64 NumQueries{};  //!< Number of `ProcessColModels` calls
+        uint64 NumReused{};   //!< Number of calls the contacts were reused for
+        uint64 NumDropped{};  //!< Number of reused contacts that were dropped, as they separated
+    };
+
+public:
+    /*!
+     * @brief Same as `CCollision::ProcessColModels` (With `bReturnAllCollisions = false`), but the contacts of `A` and `B` may be reused from the previous calls (See above)
+     * @param entityA, entityB The entities of the col models (Only used as the key)
+     */
+    static int32 ProcessColModels(
+        const CEntity& entityA, const CMatrix& transformA, CColModel& cmA,
+        const CEntity& entityB, const CMatrix& transformB, CColModel& cmB,
+        std::array<CColPoint, 32>& sphereCPs,
+        CColPoint* lineCPs,
+        float* maxTouchDistances
+    );
+
+    //! Remove the contacts that weren't used recently (Called once a frame)
+    static void Update();
+
+    //! Remove the contacts of the entity (Must be called before it's deleted, as the entries are keyed by its address)
+    static void Remove(const CEntity& entity);
+
+    //! Remove all contacts
+    static void Clear();
+
+    static const Stats& GetStats() { return s_Stats; }
+    static void         ResetStats();
+
+private:
+    struct Key {
+        const CEntity* A{}; //!< Entries are removed along with the entities (See `Remove`), so the address can't be reused while they're here
+        const CEntity* B{};
+        uint16         NumTrisA{}, NumTrisB{}; //!< Some callers hide triangles or lines temporarily (See `CAutomobile::ProcessEntityCollision`),
+        uint8          NumLinesA{};            //!< so the contacts with and without them are kept separately
+
+        bool operator==(const Key&) const = default;
+    };
+
+    struct KeyHash {
+        size_t operator()(const Key& k) const {
+            return std::hash<const void*>{}(k.A) ^ (std::hash<const void*>{}(k.B) * 31) ^ ((size_t)k.NumTrisA << 1) ^ ((size_t)k.NumTrisB << 9) ^ ((size_t)k.NumLinesA << 17);
+        }
+    };
+
+    struct Entry {
+        CMatrix          AToB{};            //!< Transform of `A` in `B`'s space when the contacts were found
+        const CColModel* ColModelA{};
+        const CColModel* ColModelB{};
+        uint32           FrameFound{};      //!< Frame the contacts were found in
+        uint32           FrameUsed{};       //!< Frame the contacts were last used in
+
+        // Contacts in `B`'s space
+        uint8                            NumSphereCPs{};
+        std::array<CColPoint, 32>        SphereCPs{};
+        std::array<CColPoint, MAX_LINES> LineCPs{};
+        std::array<float, MAX_LINES>     LineTouchDists{}; //!< 1 if the line didn't hit
+    };
+
+    static bool  CanReuse(const Entry& e, const CMatrix& aToB, const CColModel& cmA, const CColModel& cmB);
+    static void  Store(Entry& e, const CMatrix& aToB, const CMatrix& transformB, CColModel& cmA, CColModel& cmB, const std::array<CColPoint, 32>& sphereCPs, int32 numSphereCPs, const CColPoint* lineCPs, const float* touchDists, uint32 numLines);
+    static int32 Reuse(const Entry& e, const CMatrix& aToB, const CMatrix& transformB, const CCollisionData& cdA, std::array<CColPoint, 32>& sphereCPs, CColPoint* lineCPs, float* maxTouchDistances);
+
+private:
+    static inline std::unordered_map<Key, Entry, KeyHash> s_Entries{};
+    static inline Stats                                   s_Stats{};
+};
+}; // namespace notsa
@@ -0,0 +1,127 @@
+#include "StdInc.h"
+
+#include "CollisionIslands.h"
+
+namespace notsa {
+void CollisionIslands::Build() {
+    ZoneScoped;
+
+    m_Moving.clear();
+    m_Bounds.clear();
+    for (auto* const entity : CWorld::ms_listMovingEntityPtrs) {
+        const auto centre = entity->GetBoundCentre();
+        const auto radius = entity->GetColModel()->GetBoundRadius() + entity->m_vecMoveSpeed.Magnitude() * CTimer::GetTimeStep();
+        const CVector extent{ radius, radius, radius };
+
+        m_Moving.push_back(entity);
+        m_Bounds.push_back({ centre - extent, centre + extent });
+    }
+    const auto num = (uint32)m_Moving.size();
+
+    m_Stats = {};
+    m_Stats.NumEntities = num;
+
+    // Sweep and prune along the X axis, joining the islands of the overlapping pairs
+    m_Parents.resize(num);
+    std::iota(m_Parents.begin(), m_Parents.end(), 0u);
+    m_SortedByX.resize(num);
+    std::iota(m_SortedByX.begin(), m_SortedByX.end(), 0u);
+    rng::sort(m_SortedByX, [this](uint32 a, uint32 b) {
+        return m_Bounds[a].Min.x < m_Bounds[b].Min.x;
+    });
+    m_Active.clear();
+    for (const auto i : m_SortedByX) {
+        const auto& bi = m_Bounds[i];
+        std::erase_if(m_Active, [&](uint32 j) { return m_Bounds[j].Max.x < bi.Min.x; });
+        for (const auto j : m_Active) {
+            const auto& bj = m_Bounds[j];
+            if (bi.Min.y > bj.Max.y || bi.Max.y < bj.Min.y || bi.Min.z > bj.Max.z || bi.Max.z < bj.Min.z) {
+                continue;
+            }
+            m_Stats.NumPairs++;
+
+            const auto ri = FindRoot(i), rj = FindRoot(j);
+            if (ri != rj) {
+                m_Parents[std::max(ri, rj)] = std::min(ri, rj);
+            }
+        }
+        m_Active.push_back(i);
+    }
+
+    // Join the islands of the moving entities touching the same entity that isn't moving (See the header)
+    m_TouchedBy.clear();
+    const auto JoinThroughStill = [this](auto& list, uint32 i) {
+        const auto& bi = m_Bounds[i];
+        for (CPhysical* const entity : list) {
+            if (entity->m_pMovingList || !entity->GetUsesCollision() || !entity->GetColModel()) { // Moving ones were in the sweep already
+                continue;
+            }
+            const auto centre = entity->GetBoundCentre();
+            const auto radius = entity->GetColModel()->GetBoundRadius();
+            if (   centre.x + radius < bi.Min.x || centre.x - radius > bi.Max.x
+                || centre.y + radius < bi.Min.y || centre.y - radius > bi.Max.y
+                || centre.z + radius < bi.Min.z || centre.z - radius > bi.Max.z
+            ) {
+                continue;
+            }
+
+            const auto [it, isFirst] = m_TouchedBy.try_emplace(entity, i);
+            if (isFirst) {
+                continue;
+            }
+            const auto ri = FindRoot(i), rj = FindRoot(it->second);
+            if (ri != rj) {
+                m_Parents[std::max(ri, rj)] = std::min(ri, rj);
+                m_Stats.NumStillLinks++;
+            }
+        }
+    };
+    for (auto i = 0u; i < num; i++) {
+        const auto& b = m_Bounds[i];
+        CWorld::IterateSectors(CWorld::GetSectorX(b.Min.x), CWorld::GetSectorY(b.Min.y), CWorld::GetSectorX(b.Max.x), CWorld::GetSectorY(b.Max.y), [&](int32 x, int32 y) {
+            auto& rs = CWorld::GetRepeatSector(x, y);
+            JoinThroughStill(rs.Vehicles, i);
+            JoinThroughStill(rs.Peds, i);
+            JoinThroughStill(rs.Objects, i);
+            return true;
+        });
+    }
+
+    // Roots are the first entity of their island, so islands are created in the order of the moving list
+    m_Islands.clear();
+    m_IslandOf.resize(num);
+    for (auto i = 0u; i < num; i++) {
+        const auto root = FindRoot(i);
+        if (root == i) {
+            m_IslandOf[i] = (uint32)m_Islands.size();
+            m_Islands.emplace_back();
+        }
+        m_Islands[m_IslandOf[root]].Num++;
+    }
+
+    uint32 first{};
+    for (auto& island : m_Islands) {
+        island.First = first;
+        first       += island.Num;
+
+        m_Stats.NumSingles    += island.Num == 1 ? 1 : 0;
+        m_Stats.LargestIsland  = std::max(m_Stats.LargestIsland, island.Num);
+        island.Num             = 0; // Counted again below
+    }
+    m_Stats.NumIslands = (uint32)m_Islands.size();
+
+    m_Entities.resize(num);
+    for (auto i = 0u; i < num; i++) {
+        auto& island = m_Islands[m_IslandOf[FindRoot(i)]];
+        m_Entities[island.First + island.Num++] = m_Moving[i];
+    }
+}
+
+uint32 CollisionIslands::FindRoot(uint32 i) {
+    while (m_Parents[i] != i) {
+        m_Parents[i] = m_Parents[m_Parents[i]]; // Path halving
+        i            = m_Parents[i];
+    }
+    return i;
+}
+}; // namespace notsa
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+#include "Vector.h"
+
+class CPhysical;
+
+namespace notsa {
+/*!
+ * @brief NOTSA: Broadphase splitting the moving entities into islands of entities that may collide with each other this frame.
+ *
+ * `CWorld::Process` processes the collision of the moving entities one by one (5 times over), which is the most expensive part of the frame in traffic jams.
+ * Entities in different islands can't touch each other (Their bounding spheres, grown by how far they move this frame, don't overlap),
+ * so each island could be processed on its own, in the order of the moving list.
+ * Entities that aren't moving (Parked cars, objects at rest, etc.) may be pushed by one and then hit another, so moving entities touching
+ * the same one are in the same island too. Buildings and dummies never move (and aren't modified by the collision), so they don't join islands.
+ *
+ * This is a measurement tool only - The collision is still processed serially, in the order of the moving list.
+ * Processing the islands in parallel is blocked by `CPhysical::ProcessCollision` changing global state all over the place:
+ * - `CTimer`'s time step is changed per entity (For the entities processed in smaller steps)
+ * - `CCollision::ProcessColModels` still calls the original code, which uses static buffers
+ * - The scan code, the sector lists (`RemoveAndAdd`), the random number generator, events, audio, etc.
+ * The stats (See `WorldDebugModule`) give an upper bound of what processing them in parallel could gain, once those are fixed
+ * (It assumes the islands could be spread over any number of threads, without any overhead).
+ * Besides the stats, the islands are used by `PhysicalSleep` (Entities are put to sleep island-wide).
+ */
+class CollisionIslands {
+public:
+    struct Island {
+        uint32 First{}; //!< Range of `m_Entities`
+        uint32 Num{};
+    };
+
+    struct Stats {
+        uint32 NumEntities{};   //!< Number of moving entities
+        uint32 NumPairs{};      //!< Number of pairs of them whose bounds overlap
+        uint32 NumStillLinks{}; //!< Number of times 2 islands were joined because they touch the same entity that isn't moving
+        uint32 NumIslands{};
+        uint32 NumSingles{};    //!< Number of islands with a single entity
+        uint32 LargestIsland{}; //!< Number of entities in the largest island
+    };
+
+public:
+    //! Build the islands of the moving entities (`CWorld::ms_listMovingEntityPtrs`)
+    void Build();
+
+    std::span<const Island> GetIslands() const { return m_Islands; }
+
+    //! Entities of the island, in the order they're in the moving list
+    std::span<CPhysical* const> GetEntities(const Island& island) const { return std::span{ m_Entities }.subspan(island.First, island.Num); }
+
+    const Stats& GetStats() const { return m_Stats; }
+
+private:
+    uint32 FindRoot(uint32 i);
+
+private:
+    struct Bounds {
+        CVector Min{}, Max{};
+    };
+
+    std::vector<CPhysical*> m_Entities{}; //!< Grouped by island
+    std::vector<Island>     m_Islands{};  //!< In the order of their first entity in the moving list
+    Stats                   m_Stats{};
+
+    // Scratch buffers of `Build` (Indices are of `m_Moving`)
+    std::vector<CPhysical*> m_Moving{};    //!< The moving list
+    std::vector<Bounds>     m_Bounds{};
+    std::vector<uint32>     m_SortedByX{}; //!< Sorted by `Bounds::Min.x`
+    std::vector<uint32>     m_Active{};    //!< Entities of the sweep whose bounds may still overlap the next one's
+    std::vector<uint32>     m_Parents{};   //!< Union-find - The root of an island is its entity that's first in the moving list
+    std::vector<uint32>     m_IslandOf{};  //!< Island of each root
+
+    std::unordered_map<const CPhysical*, uint32> m_TouchedBy{}; //!< Entities that aren't moving => A moving entity touching it
+};
+}; // namespace notsa
@@ -7,7 +7,9 @@
 #pragma once
 
 #include <Base.h>
+#include <bit>
 #include <cstdint>
+#include <vector>
 
 #define INVALID_POOL_SLOT (-1)
 
@@ -34,6 +36,33 @@ private:
 
     VALIDATE_SIZE(SlotState, 1);
 
+    /*!
+    * @brief NOTSA: Out-of-line acceleration structures.
+    * @brief `CPool` must keep its vanilla layout (See `COctTree::ms_octTreePool`), so
+    * @brief a pointer to this is stored right after the last `SlotState` (See `GetAccel`)
+    */
+    struct Accel {
+        constexpr static int32 NOT_IN_FREELIST = -2;
+
+        bool               UseFreeList{};         //!< If the free-list is used for finding free slots (instead of scanning `m_SlotState`)
+        int32              FreeListHead{ -1 };    //!< First slot of the free-list (`-1` if empty)
+        std::vector<int32> FreeListNext{};        //!< Next slot in the free-list for each slot (`-1` if last)
+        std::vector<int32> FreeListPrev{};        //!< Previous slot in the free-list for each slot (`-1` if first, `NOT_IN_FREELIST` if not linked)
+
+        bool                TrackOccupancy{};     //!< If `Occupancy` and `NumUsed` are maintained
+        std::vector<uint32> Occupancy{};          //!< Bit `i` is set if slot `i` is in use (Used for skipping free slots when iterating)
+        size_t              NumUsed{};            //!< Number of used slots
+
+        struct Chunk {
+            std::unique_ptr<StorageType[]> Storage{};
+            std::unique_ptr<SlotState[]>   States{};
+        };
+        size_t             ChunkCapacity{};       //!< No. of slots added by each `Grow` (`0` if the pool can't grow)
+        size_t             MaxCapacity{};         //!< The pool won't grow beyond this many slots
+        std::vector<Chunk> Chunks{};              //!< Chunks added by `Grow`, these are slots `[m_Capacity, Capacity)`
+        size_t             Capacity{};            //!< Total no. of slots, including `Chunks`
+    };
+
 private:
     /*
     * Debug fill bytes for compatibility with MSVC/C++ debug heap
@@ -50,6 +79,8 @@ private:
     constexpr static auto DEADLAND_FILL   = 0xDD; //!< Delete'd objects are filled with this
     constexpr static auto CLEANLAND_FILL  = 0xCD; //!< New'd objects are filled with this (Expect the constructor to overwrite most of this)
 
+    constexpr static size_t MAX_CAPACITY = 1 << 23; //!< Refs (handles) store the index in the upper 24 bits of an `int32`
+
 public:
     /*!
     * @brief Default constructor, with no memory allocated
@@ -61,14 +92,16 @@ public:
     ****/
     CPool(size_t capacity, const char* name) :
         m_Storage{ new StorageType[capacity] },
-        m_SlotState{ new SlotState[capacity] },
+        m_SlotState{ new SlotState[capacity + sizeof(Accel*)] }, // Extra space for the `Accel` pointer
         m_Capacity{ capacity },
-        m_OwnsAllocations{ true }
+        m_OwnsAllocations{ true },
+        m_HasAccel{ true }
     {
         assert(m_Storage);
         assert(m_SlotState);
 
         rng::uninitialized_fill(m_SlotState, m_SlotState + capacity, SlotState{});
+        SetAccel(new Accel{ .Capacity = capacity });
         DoFill(NOMANSLAND_FILL);
     }
 
@@ -99,9 +132,10 @@ public:
         swap(a.m_Storage, b.m_Storage);
         swap(a.m_SlotState, b.m_SlotState);
         swap(a.m_Capacity, b.m_Capacity);
-        swap(a.m_FirstFreeSlot, b.m_FirstFreeSlot);
+        swap(a.m_LastFreeSlot, b.m_LastFreeSlot);
         swap(a.m_OwnsAllocations, b.m_OwnsAllocations);
         swap(a.m_DealWithNoMemory, b.m_DealWithNoMemory);
+        swap(a.m_HasAccel, b.m_HasAccel);
     }
 
     /* The `Init` function has been replaced by a constructor taking the same args */
@@ -111,6 +145,7 @@ public:
     */
     void Flush() {
         DoFill(NOMANSLAND_FILL);
+        delete GetAccel();
         if (m_OwnsAllocations) {
             delete[] std::exchange(m_Storage, nullptr);
             delete[] std::exchange(m_SlotState, nullptr);
@@ -119,18 +154,20 @@ public:
         m_LastFreeSlot     = -1;
         m_OwnsAllocations  = false;
         m_DealWithNoMemory = false;
+        m_HasAccel         = false;
     }
 
     // Clears pool
     void Clear() {
-        for (auto i = 0; i < m_Capacity; i++) {
-            m_SlotState[i].IsEmpty = true;
+        for (auto i = 0u; i < GetCapacity(); i++) {
+            GetSlotState(i).IsEmpty = true;
         }
+        AccelRebuild();
         DoFill(DEADLAND_FILL);
     }
 
     auto GetSize() {
-        return m_Capacity;
+        return GetCapacity();
     }
 
     /*!
@@ -139,7 +176,7 @@ public:
     // 0x404940
     bool IsFreeSlotAtIndex(size_t idx) const {
         assert(IsIndexInBounds(idx));
-        return m_SlotState[idx].IsEmpty;
+        return GetSlotState(idx).IsEmpty;
     }
 
     /*!
@@ -147,7 +184,18 @@ public:
     */
     auto GetIndex(const T* obj) const {
         assert(IsPtrFromPool(obj));
-        return (StorageType*)(obj) - (StorageType*)(m_Storage);
+        const auto ptr = (StorageType*)(obj);
+        if (m_Storage <= ptr && ptr < m_Storage + m_Capacity) {
+            return ptr - m_Storage;
+        }
+        const auto a = GetAccel();
+        for (auto i = 0u; i < a->Chunks.size(); i++) {
+            const auto storage = a->Chunks[i].Storage.get();
+            if (storage <= ptr && ptr < storage + a->ChunkCapacity) {
+                return (ptrdiff_t)(m_Capacity + i * a->ChunkCapacity) + (ptr - storage);
+            }
+        }
+        NOTSA_UNREACHABLE();
     }
 
     /*!
@@ -155,7 +203,7 @@ public:
     */
     T* GetAt(size_t idx) {
         assert(IsIndexInBounds(idx));
-        return !IsFreeSlotAtIndex(idx) ? (T*)&m_Storage[idx] : nullptr;
+        return !IsFreeSlotAtIndex(idx) ? (T*)GetSlotStorage(idx) : nullptr;
     }
 
     /*!
@@ -163,7 +211,8 @@ public:
     */
     void SetFreeAt(size_t idx, bool isFree) {
         assert(IsIndexInBounds(idx));
-        m_SlotState[idx].IsEmpty = isFree;
+        GetSlotState(idx).IsEmpty = isFree;
+        AccelOnSlotStateChanged((int32)(idx), isFree);
     }
 
     /*!
@@ -171,7 +220,7 @@ public:
     */
     void SetIdAt(size_t idx, uint8 id) {
         assert(IsIndexInBounds(idx));
-        m_SlotState[idx].Ref = id;
+        GetSlotState(idx).Ref = id;
     }
 
     /*!
@@ -179,7 +228,7 @@ public:
     */
     uint8 GetIdAt(size_t idx) {
         assert(IsIndexInBounds(idx));
-        return m_SlotState[idx].Ref;
+        return GetSlotState(idx).Ref;
     }
 
     /*!
@@ -198,12 +247,13 @@ public:
         assert(IsIndexInBounds(i) && "Free slot index is out-of-bounds");
         assert(IsFreeSlotAtIndex(i) && "Can't allocate an object at a non-free slot");
 
-        auto* const state = &m_SlotState[i];
+        auto* const state = &GetSlotState(i);
         const auto isFirstAllocation = state->Ref == 0; // First allocation of this slot?
         state->IsEmpty = false;
         state->Ref++;
+        AccelOnSlotStateChanged(i, false);
 
-        StorageType* ptr = &m_Storage[i];
+        StorageType* ptr = GetSlotStorage(i);
         // NOTE/TODO: Works, and does find bugs (...that I'm lazy to fix right now)
         //if (!isFirstAllocation) {
         //    CheckFill(DEADLAND_FILL, ptr); // Theoretically `isFirstAllocation ? NOMANSLAND_FILL : DEADLAND_FILL` would work, but we don't have every and all constructor of this class hooked
@@ -219,8 +269,13 @@ public:
         const auto idx           = GetIndexFromRef(ref); // GetIndexFromRef asserts if idx out of range
         assert(IsFreeSlotAtIndex(idx) && "Can't create an object at a non-free slot");
 
-        m_SlotState[idx].IsEmpty = false;
-        m_SlotState[idx].Ref     = ref & 0x7F;
+        GetSlotState(idx).IsEmpty = false;
+        GetSlotState(idx).Ref     = ref & 0x7F;
+        AccelOnSlotStateChanged(idx, false);
+        if (const auto a = GetAccel(); a && a->UseFreeList) {
+            m_LastFreeSlot = a->FreeListHead; // Not used by us in this mode, but keep it sensible
+            return;
+        }
         m_LastFreeSlot           = 0;
         while (!m_SlotState[m_LastFreeSlot].IsEmpty) { // Find next free
             ++m_LastFreeSlot;
@@ -232,10 +287,12 @@ public:
     * @returns A ptr to the object at ref
     */
     T* NewAt(int32 ref) {
+        while (!IsIndexInBounds(ref >> 8) && Grow() != -1) { // NOTSA: Make sure refs from chunks (e.g.: from a save) are valid
+        }
         const auto idx = GetIndexFromRef(ref);
         assert(IsFreeSlotAtIndex(idx) && "Can't create an object at a non-free slot");
 
-        StorageType* ptr = &m_Storage[idx];
+        StorageType* ptr = GetSlotStorage(idx);
         CreateAtRef(ref);
         DoFill(CLEANLAND_FILL, ptr);
         return (T*)(void*)(ptr);
@@ -253,8 +310,9 @@ public:
         assert(!IsFreeSlotAtIndex(GetIndex(obj)) && "Can't delete an already deleted object");
 
         const auto idx = GetIndex(obj);
-        m_SlotState[idx].IsEmpty = true;
+        GetSlotState(idx).IsEmpty = true;
         m_LastFreeSlot          = std::min(m_LastFreeSlot, idx);
+        AccelOnSlotStateChanged(idx, true);
         DoFill(DEADLAND_FILL, (StorageType*)(obj));
     }
 
@@ -263,7 +321,7 @@ public:
     */
     int32 GetRef(const T* obj) {
         const auto idx = GetIndex(obj);
-        return (idx << 8) | m_SlotState[idx].ToInt();
+        return (idx << 8) | GetSlotState(idx).ToInt();
     }
 
     /*!
@@ -271,8 +329,8 @@ public:
     */
     T* GetAtRef(int32 ref) {
         int32 idx = ref >> 8; // It is possible the ref is invalid here, thats why we check for the idx is valid below (And also why GetIndexFromRef isn't used, it would assert)
-        return IsIndexInBounds(idx) && m_SlotState[idx].ToInt() == (ref & 0xFF)
-            ? reinterpret_cast<T*>(&m_Storage[idx])
+        return IsIndexInBounds(idx) && GetSlotState(idx).ToInt() == (ref & 0xFF)
+            ? reinterpret_cast<T*>(GetSlotStorage(idx))
             : nullptr;
     }
 
@@ -282,16 +340,21 @@ public:
 
     /*!
     * @addr 0x54F6B0
-    * @brief Calculate the number of used slots. CAUTION: Slow, especially for large pools.
+    * @brief Calculate the number of used slots. CAUTION: Slow, especially for large pools (Unless occupancy is tracked, see `SetTrackOccupancy`)
     */
     size_t GetNoOfUsedSpaces() {
-        return (size_t)std::count_if(m_SlotState, m_SlotState + m_Capacity, [](auto&& v) {
-            return !v.IsEmpty;
-        });
+        if (const auto a = GetAccel(); a && a->TrackOccupancy) {
+            return a->NumUsed;
+        }
+        size_t n = 0;
+        for (auto i = 0u; i < GetCapacity(); i++) {
+            n += !GetSlotState(i).IsEmpty;
+        }
+        return n;
     }
 
     auto GetNoOfFreeSpaces() {
-        return m_Capacity - GetNoOfUsedSpaces();
+        return GetCapacity() - GetNoOfUsedSpaces();
     }
 
     // 0x54F690
@@ -308,14 +371,22 @@ public:
     * @brief Check if index is in array bounds
     */
     [[nodiscard]] bool IsIndexInBounds(size_t idx) const {
-        return idx >= 0 && idx < m_Capacity;
+        return idx >= 0 && idx < GetCapacity();
     }
 
     /*!
     * @brief Check if the pointer is from this pool 
     */
     bool IsPtrFromPool(const T* ptr) const {
-        return m_Storage <= (StorageType*)(ptr) && (StorageType*)(ptr) < m_Storage + m_Capacity;
+        if (m_Storage <= (StorageType*)(ptr) && (StorageType*)(ptr) < m_Storage + m_Capacity) {
+            return true;
+        }
+        if (const auto a = GetAccel()) {
+            return rng::any_of(a->Chunks, [&](auto&& chunk) {
+                return chunk.Storage.get() <= (StorageType*)(ptr) && (StorageType*)(ptr) < chunk.Storage.get() + a->ChunkCapacity;
+            });
+        }
+        return false;
     }
 
     /*!
@@ -331,14 +402,146 @@ public:
     void SetDealWithNoMemory(bool enabled) { m_DealWithNoMemory = enabled; }
     bool CanDealWithNoMemory() const { return m_DealWithNoMemory; }
 
+    /*!
+    * @notsa
+    * @brief Enable/disable the free-list, making `New` and `Delete` O(1) instead of a linear scan of the slots.
+    * @brief Slots freed by unhooked code never make it into the list, so only use it for pools whose every deallocation goes through a hooked function.
+    * @brief Has no effect for pools that don't own their memory (See the non-owning constructor)
+    */
+    void SetUseFreeList(bool enabled) {
+        const auto a = GetAccel();
+        if (!a || a->UseFreeList == enabled) {
+            return;
+        }
+        a->UseFreeList = enabled;
+        if (enabled) {
+            a->FreeListNext.resize(a->Capacity);
+            a->FreeListPrev.resize(a->Capacity);
+            FreeListRebuild(*a);
+        } else {
+            a->FreeListHead = -1;
+            a->FreeListNext = {};
+            a->FreeListPrev = {};
+        }
+    }
+    bool IsUsingFreeList() const { const auto a = GetAccel(); return a && a->UseFreeList; }
+
+    /*!
+    * @notsa
+    * @brief Enable/disable the occupancy bitmap, making iteration (`GetAllValid`, etc) skip free slots in bulk, and `GetNoOfUsedSpaces` O(1).
+    * @brief Objects allocated by unhooked code would be skipped by iteration, so only use it for pools whose every allocation goes through a hooked function.
+    * @brief Has no effect for pools that don't own their memory (See the non-owning constructor)
+    */
+    void SetTrackOccupancy(bool enabled) {
+        const auto a = GetAccel();
+        if (!a || a->TrackOccupancy == enabled) {
+            return;
+        }
+        a->TrackOccupancy = enabled;
+        if (enabled) {
+            a->Occupancy.resize((a->Capacity + 31) / 32);
+            OccupancyRebuild(*a);
+        } else {
+            a->Occupancy = {};
+            a->NumUsed   = 0;
+        }
+    }
+    bool IsTrackingOccupancy() const { const auto a = GetAccel(); return a && a->TrackOccupancy; }
+
+    /*!
+    * @notsa
+    * @brief Allow the pool to grow by `chunkCapacity` slots at a time (up to `maxCapacity`) once it's full, instead of failing the allocation.
+    * @brief Pointers to objects stay valid, as the chunks are never reallocated.
+    * @brief `m_Capacity`, `m_Storage` and `m_SlotState` only cover the vanilla slots, and unhooked code indexes them directly, without bounds checks.
+    * @brief So objects in the chunks must never reach unhooked code by ref or index, nor be freed by it (It'd compute the index from the pointer).
+    * @brief That is, only pools whose objects have no refs, and whose every allocation/deallocation in unhooked code goes through a hooked function are safe to grow:
+    * @brief - Entry info nodes (`CEntryInfoNode::operator new/delete`)
+    * @brief - Events (`CEvent::operator new/delete`)
+    * @brief Peds, vehicles, objects, buildings, dummies, col models, etc. all have refs/indices used by unhooked code, and ptr nodes are freed by it.
+    * @brief Has no effect for pools that don't own their memory (See the non-owning constructor)
+    */
+    void SetGrowable(size_t chunkCapacity, size_t maxCapacity) {
+        if (const auto a = GetAccel()) {
+            a->ChunkCapacity = chunkCapacity;
+            a->MaxCapacity   = std::min(maxCapacity, MAX_CAPACITY);
+        }
+    }
+    bool IsGrowable() const { const auto a = GetAccel(); return a && a->ChunkCapacity && a->Capacity < a->MaxCapacity; }
+
+    //! NOTSA: Total no. of slots (Including the chunks of growable pools)
+    size_t GetCapacity() const {
+        const auto a = GetAccel();
+        return a ? a->Capacity : m_Capacity;
+    }
+
+    /*!
+    * @notsa
+    * @brief Find the first used slot at or after `idx`
+    * @return The index of the slot, or the capacity if there are no more used slots
+    */
+    int32 FindNextUsedSlot(int32 idx) const {
+        const auto cap = (int32)(GetCapacity());
+        if (const auto a = GetAccel(); a && a->TrackOccupancy) {
+            while (idx < cap) {
+                auto w    = (size_t)(idx / 32);
+                auto bits = a->Occupancy[w] & (~0u << (idx % 32));
+                while (!bits) {
+                    if (++w == a->Occupancy.size()) {
+                        return cap;
+                    }
+                    bits = a->Occupancy[w];
+                }
+                idx = (int32)(w * 32) + std::countr_zero(bits);
+                if (!GetSlotState(idx).IsEmpty) { // Might've been freed by unhooked code
+                    return idx;
+                }
+                idx++;
+            }
+            return cap;
+        }
+        while (idx < cap && GetSlotState(idx).IsEmpty) {
+            idx++;
+        }
+        return std::min(idx, cap);
+    }
+
+    //! NOTSA - End of the used slots (See `UsedSlotIterator`)
+    struct UsedSlotSentinel {};
+
+    //! NOTSA - Forward iterator over the indices of the used slots
+    class UsedSlotIterator {
+    public:
+        using value_type      = int32;
+        using difference_type = std::ptrdiff_t;
+
+        UsedSlotIterator() = default;
+        UsedSlotIterator(const CPool* pool, int32 idx) : m_Pool{ pool }, m_Idx{ idx } {}
+
+        int32 operator*() const { return m_Idx; }
+
+        UsedSlotIterator& operator++() { m_Idx = m_Pool->FindNextUsedSlot(m_Idx + 1); return *this; }
+        UsedSlotIterator  operator++(int) { auto tmp = *this; ++*this; return tmp; }
+
+        bool operator==(const UsedSlotIterator&) const = default;
+
+        //! The capacity is checked every time (instead of being stored in the sentinel), as the pool might grow while it's being iterated
+        bool operator==(UsedSlotSentinel) const { return m_Idx >= (int32)(m_Pool->GetCapacity()); }
+
+    private:
+        const CPool* m_Pool{};
+        int32        m_Idx{};
+    };
+
+    // NOTSA - Get the indices of all used slots
+    auto GetUsedSlotIndices() const {
+        return rng::subrange{ UsedSlotIterator{ this, FindNextUsedSlot(0) }, UsedSlotSentinel{} };
+    }
+
     // NOTSA - Get all valid objects with their index - Useful for iteration
     template<typename R = T>
     auto GetAllValidWithIndex() {
-        return std::span{ reinterpret_cast<StorageType*>(m_Storage), (size_t)(m_Capacity) }
-            | rngv::transform([this](auto&& obj) -> R* { return (R*)(void*)(&obj); })                                 // Convert to object pointer
-            | rngv::enumerate                                                                                         // Add index to non-filtered range
-            | rngv::filter([this](auto&& p) { return !IsFreeSlotAtIndex(std::get<0>(p)); })                           // Filter out free slots
-            | rngv::transform([](auto&& p) -> std::tuple<int32, R&> { return { std::get<0>(p), *std::get<1>(p) }; }); // Convert obj pointer to ref 
+        return GetUsedSlotIndices()
+            | rngv::transform([this](int32 idx) -> std::tuple<int32, R&> { return { idx, *(R*)(void*)(GetSlotStorage(idx)) }; }); // Index to (index, obj ref) pair
     }
 
     // NOTSA - Get all valid objects - Useful for iteration
@@ -354,6 +557,11 @@ protected:
             memset(at, fill, sizeof(StorageType)); /* One object */
         } else {
             memset(m_Storage, fill, sizeof(StorageType) * m_Capacity); /* Whole storage */
+            if (const auto a = GetAccel()) {
+                for (auto& chunk : a->Chunks) {
+                    memset(chunk.Storage.get(), fill, sizeof(StorageType) * a->ChunkCapacity);
+                }
+            }
         }
     }
 
@@ -365,25 +573,202 @@ protected:
         }
     }
 
-    int32 FindFreeSlot() const {
+    int32 FindFreeSlot() {
+        if (const auto a = GetAccel(); a && a->UseFreeList) {
+            if (const auto i = FreeListPop(*a); i != -1) {
+                return i;
+            }
+            // Slots freed by unhooked code never make it into the list, so fall back to scanning
+        }
+
         const auto last = m_LastFreeSlot != -1 ? m_LastFreeSlot : 0;
-        const auto cap  = m_Capacity;
+        const auto cap  = (int32)(GetCapacity());
 
         // Try [last, cap)
         for (auto i = last; i < cap; i++) {
-            if (m_SlotState[i].IsEmpty) {
+            if (GetSlotState(i).IsEmpty) {
                 return i;
             }
         }
 
         // Try [0, last)
         for (auto i = 0; i < last; i++) {
-            if (m_SlotState[i].IsEmpty) {
+            if (GetSlotState(i).IsEmpty) {
                 return i;
             }
         }
 
-        // No free slots
+        // No free slots, last resort is growing (if allowed)
+        return Grow();
+    }
+
+    /*!
+    * @notsa
+    * @brief Add a new chunk of slots (See `SetGrowable`)
+    * @return Index of the first slot of the new chunk, `-1` if the pool can't grow
+    */
+    int32 Grow() {
+        const auto a = GetAccel();
+        if (!a || !a->ChunkCapacity || a->Capacity + a->ChunkCapacity > a->MaxCapacity) {
+            return -1;
+        }
+
+        auto& chunk = a->Chunks.emplace_back(
+            std::unique_ptr<StorageType[]>{ new StorageType[a->ChunkCapacity] },
+            std::unique_ptr<SlotState[]>{ new SlotState[a->ChunkCapacity] }
+        );
+        memset(chunk.Storage.get(), NOMANSLAND_FILL, sizeof(StorageType) * a->ChunkCapacity);
+
+        const auto first = a->Capacity;
+        a->Capacity += a->ChunkCapacity;
+        if (a->UseFreeList) {
+            a->FreeListNext.resize(a->Capacity);
+            a->FreeListPrev.resize(a->Capacity, Accel::NOT_IN_FREELIST);
+            for (auto i = a->Capacity; i --> first;) {
+                FreeListPush(*a, (int32)(i));
+            }
+        }
+        if (a->TrackOccupancy) {
+            a->Occupancy.resize((a->Capacity + 31) / 32);
+        }
+        NOTSA_LOG_DEBUG("Pool of {} grown to {} slots", typeid(T).name(), a->Capacity);
+
+        return (int32)(first);
+    }
+
+    SlotState& GetSlotState(size_t idx) const {
+        if (idx < m_Capacity) {
+            return m_SlotState[idx];
+        }
+        const auto a = GetAccel();
+        idx -= m_Capacity;
+        return a->Chunks[idx / a->ChunkCapacity].States[idx % a->ChunkCapacity];
+    }
+
+    StorageType* GetSlotStorage(size_t idx) const {
+        if (idx < m_Capacity) {
+            return &m_Storage[idx];
+        }
+        const auto a = GetAccel();
+        idx -= m_Capacity;
+        return &a->Chunks[idx / a->ChunkCapacity].Storage[idx % a->ChunkCapacity];
+    }
+
+    Accel* GetAccel() const {
+        if (!m_HasAccel) {
+            return nullptr;
+        }
+        Accel* a;
+        std::memcpy(&a, (const void*)(m_SlotState + m_Capacity), sizeof(a));
+        return a;
+    }
+
+    void SetAccel(Accel* a) {
+        assert(m_HasAccel);
+        std::memcpy((void*)(m_SlotState + m_Capacity), &a, sizeof(a));
+    }
+
+    //! Update the acceleration structures after the state of a slot has changed
+    void AccelOnSlotStateChanged(int32 idx, bool isFree) {
+        const auto a = GetAccel();
+        if (!a) {
+            return;
+        }
+        if (a->UseFreeList) {
+            if (isFree) {
+                FreeListPush(*a, idx);
+            } else {
+                FreeListUnlink(*a, idx);
+            }
+        }
+        if (a->TrackOccupancy) {
+            auto&      word = a->Occupancy[idx / 32];
+            const auto bit  = 1u << (idx % 32);
+            if (!(word & bit) != isFree) { // Only count actual changes
+                word ^= bit;
+                if (isFree) {
+                    a->NumUsed--;
+                } else {
+                    a->NumUsed++;
+                }
+            }
+        }
+    }
+
+    //! Rebuild all acceleration structures from `m_SlotState`
+    void AccelRebuild() {
+        const auto a = GetAccel();
+        if (!a) {
+            return;
+        }
+        if (a->UseFreeList) {
+            FreeListRebuild(*a);
+        }
+        if (a->TrackOccupancy) {
+            OccupancyRebuild(*a);
+        }
+    }
+
+    void OccupancyRebuild(Accel& a) {
+        rng::fill(a.Occupancy, 0u);
+        a.NumUsed = 0;
+        for (auto i = 0u; i < a.Capacity; i++) {
+            if (!GetSlotState(i).IsEmpty) {
+                a.Occupancy[i / 32] |= 1u << (i % 32);
+                a.NumUsed++;
+            }
+        }
+    }
+
+    //! Link all free slots into the free-list, lowest index first
+    void FreeListRebuild(Accel& a) {
+        a.FreeListHead = -1;
+        rng::fill(a.FreeListPrev, Accel::NOT_IN_FREELIST);
+        for (auto i = (int32)(a.Capacity) - 1; i >= 0; i--) {
+            if (GetSlotState(i).IsEmpty) {
+                FreeListPush(a, i);
+            }
+        }
+    }
+
+    void FreeListPush(Accel& a, int32 idx) {
+        if (a.FreeListPrev[idx] != Accel::NOT_IN_FREELIST) {
+            return; // Already linked
+        }
+        a.FreeListPrev[idx] = -1;
+        a.FreeListNext[idx] = a.FreeListHead;
+        if (a.FreeListHead != -1) {
+            a.FreeListPrev[a.FreeListHead] = idx;
+        }
+        a.FreeListHead = idx;
+    }
+
+    void FreeListUnlink(Accel& a, int32 idx) {
+        const auto prev = a.FreeListPrev[idx];
+        if (prev == Accel::NOT_IN_FREELIST) {
+            return; // Not linked
+        }
+        const auto next = a.FreeListNext[idx];
+        if (prev != -1) {
+            a.FreeListNext[prev] = next;
+        } else {
+            a.FreeListHead = next;
+        }
+        if (next != -1) {
+            a.FreeListPrev[next] = prev;
+        }
+        a.FreeListPrev[idx] = Accel::NOT_IN_FREELIST;
+    }
+
+    //! Unlink and return the first free slot of the free-list (`-1` if none)
+    int32 FreeListPop(Accel& a) {
+        while (a.FreeListHead != -1) {
+            const auto idx = a.FreeListHead;
+            FreeListUnlink(a, idx);
+            if (GetSlotState(idx).IsEmpty) { // Might've been allocated by unhooked code
+                return idx;
+            }
+        }
         return -1;
     }
 
@@ -394,5 +779,6 @@ private:
     int32        m_LastFreeSlot{ -1 };  //!< Last free slot in the storage
     bool         m_OwnsAllocations{};   //!< If the allocated arrays (`m_Storage` and `m_SlotState` is owned by, if so, we need to free them)
     bool         m_DealWithNoMemory{};  //!< If the caller is expected to be able to handle out-of-memory situations (Used for debugging) (AKA m_bIsLocked)
+    bool         m_HasAccel{};          //!< NOTSA: If `m_SlotState` is followed by a pointer to an `Accel` (Only for pools created by the owning constructor) [Lives in the padding]
 };
 VALIDATE_SIZE(CPool<int32>, 0x14);
@@ -7,7 +7,7 @@ void CBuilding::InjectHooks()
     RH_ScopedVirtualClass(CBuilding, 0x8585C8, 22);
     RH_ScopedCategory("Entity");
 
-    RH_ScopedInstall(ReplaceWithNewModel, 0x403EC0);
+    RH_ScopedInstall(ReplaceWithNewModel, 0x403EC0, {.locked = true}); // Locked because of `ms_SpatialIndex.MarkDirty`
     RH_ScopedGlobalInstall(IsBuildingPointerValid, 0x4040E0);
 }
 
@@ -33,6 +33,7 @@ void CBuilding::ReplaceWithNewModel(int32 newModelIndex)
     if (!CModelInfo::GetModelInfo(GetModelIndex())->m_nRefCount)
         CStreaming::RemoveModel(GetModelIndex());
 
+    CWorld::ms_SpatialIndex.MarkDirty(GetBoundRect()); // NOTSA: The bounding sphere changes with the model
     m_nModelIndex = newModelIndex;
 }
 
@@ -22,17 +22,18 @@
 #include "TheScripts.h"
 #include "Shadows.h"
 #include "CustomBuildingRenderer.h"
+#include "ContactCache.h"
 
 void CEntity::InjectHooks() {
     RH_ScopedVirtualClass(CEntity, 0x863928, 22);
     RH_ScopedCategory("Entity");
 
     RH_ScopedInstall(Constructor, 0x532A90);
-    RH_ScopedInstall(Destructor, 0x535E90);
+    RH_ScopedInstall(Destructor, 0x535E90, {.locked = true}); // Locked because of `notsa::ContactCache::Remove`
 
     //RH_ScopedOverloadedInstall(Add, "void", 0x533020, void(CEntity::*)());
-    RH_ScopedOverloadedInstall(Add, "rect", 0x5347D0, void(CEntity::*)(const CRect&));
-    RH_ScopedVMTInstall(Remove, 0x534AE0);
+    RH_ScopedOverloadedInstall(Add, "rect", 0x5347D0, void(CEntity::*)(const CRect&), {.locked = true}); // Locked because of `ms_SpatialIndex.MarkDirty`
+    RH_ScopedVMTInstall(Remove, 0x534AE0, {.locked = true}); // Locked because of `ms_SpatialIndex.MarkDirty`
     RH_ScopedVMTInstall(SetIsStatic, 0x403E20);
     RH_ScopedVMTInstall(SetModelIndex, 0x532AE0);
     RH_ScopedVMTInstall(SetModelIndexNoCreate, 0x533700);
@@ -136,6 +137,7 @@ CEntity::~CEntity() {
 
     CEntity::DeleteRwObject();
     CEntity::ResolveReferences();
+    notsa::ContactCache::Remove(*this); // NOTSA: Entities may be deleted without being removed from the world first
 }
 
 // Adds the entity to the world sectors based on its current bounding rectangle
@@ -182,6 +184,9 @@ void CEntity::Add(const CRect& rect) {
             case ENTITY_TYPE_OBJECT:   ProcessAddItem(rs.Objects); break;
             case ENTITY_TYPE_BUILDING: ProcessAddItem(s.Buildings); break;
             }
+            if (GetIsTypeBuilding() || GetIsTypeDummy()) {
+                CWorld::ms_SpatialIndex.MarkDirty(x, y); // NOTSA
+            }
             return true;
         });
     }
@@ -224,6 +229,9 @@ void CEntity::Remove() {
             case ENTITY_TYPE_OBJECT:   ProcessDeleteItem(rs.Objects); break;
             case ENTITY_TYPE_BUILDING: ProcessDeleteItem(s.Buildings); break;
             }
+            if (GetIsTypeBuilding() || GetIsTypeDummy()) {
+                CWorld::ms_SpatialIndex.MarkDirty(x, y); // NOTSA
+            }
             return true;
         });
     }
@@ -1580,7 +1588,13 @@ void CEntity::UpdateAnim() {
         fStep = CTimer::GetTimeStepInSeconds();
     }
 
-    RpAnimBlendClumpUpdateAnimations(GetRpClump(), fStep, bOnScreen);
+    const auto bones = bOnScreen && GetIsTypePed() // NOTSA
+        ? notsa::AnimLOD::GetBones(*AsPed())
+        : notsa::AnimLOD::Bones::ALL;
+    RpAnimBlendClumpUpdateAnimationsLOD(GetRpClump(), fStep, bOnScreen, bones);
+    if (bOnScreen && GetIsTypePed()) { // NOTSA
+        notsa::AnimLOD::OnAnimsUpdated(*AsPed(), bones);
+    }
 }
 
 // Checks if the entity is currently visible on screen
@@ -11,6 +11,7 @@
 #include "Glass.h"
 #include "TaskSimpleClimb.h"
 #include "RealTimeShadowManager.h"
+#include "ContactCache.h"
 
 void CPhysical::InjectHooks()
 {
@@ -585,7 +586,7 @@ bool CPhysical::TestCollision(bool bApplySpeed) {
 // 0x546D00
 int32 CPhysical::ProcessEntityCollision(CEntity* entity, CColPoint* colPoint) {
     CColModel* colModel = CModelInfo::GetModelInfo(m_nModelIndex)->GetColModel();
-    int32 totalColPointsToProcess = CCollision::ProcessColModels(*m_matrix, *colModel, entity->GetMatrix(), *entity->GetColModel(), *(std::array<CColPoint, 32>*)colPoint/*should be okay for now*/, nullptr, nullptr, false);
+    int32 totalColPointsToProcess = notsa::ContactCache::ProcessColModels(*this, *m_matrix, *colModel, *entity, entity->GetMatrix(), *entity->GetColModel(), *(std::array<CColPoint, 32>*)colPoint/*should be okay for now*/, nullptr, nullptr); // NOTSA: Contacts may be cached
     if (totalColPointsToProcess > 0) {
         AddCollisionRecord(entity);
         if (!entity->GetIsTypeBuilding())
@@ -19,6 +19,7 @@
 #include "InterestingEvents.h"
 #include "VehicleRecording.h"
 #include "EventDanger.h"
+#include "ContactCache.h"
 
 #include <Tasks/TaskTypes/TaskSimpleGangDriveBy.h>
 
@@ -1749,13 +1750,12 @@ int32 CAutomobile::ProcessEntityCollision(CEntity* entity, CColPoint* outColPoin
     // For ghosts we dont do shit (In case this garbage is a forklift this value is modified below)
     auto numColPts = GetStatus() == STATUS_GHOST
         ? 0
-        : CCollision::ProcessColModels(
-            GetMatrix(), *GetColModel(),
-            entity->GetMatrix(), *entity->GetColModel(),
+        : notsa::ContactCache::ProcessColModels( // NOTSA: Contacts may be cached
+            *this, GetMatrix(), *GetColModel(),
+            *entity, entity->GetMatrix(), *entity->GetColModel(),
             *(std::array<CColPoint, 32>*)(outColPoints),
             aAutomobileColPoints.data(),
-            wheelColPtsTouchDists.data(),
-            false
+            wheelColPtsTouchDists.data()
         );
 
     // Restore hidden triangles
@@ -2,6 +2,8 @@
 
 #include "EntityScanner.h"
 
+#include "extensions/Configs/World.hpp"
+
 void CEntityScanner::InjectHooks() {
     RH_ScopedClass(CEntityScanner);
     RH_ScopedCategoryGlobal();
@@ -39,5 +41,35 @@ void CEntityScanner::Clear() {
 
 // 0x5FFA20
 void CEntityScanner::ScanForEntitiesInRange(const eRepeatSectorList sectorList, const CPed& ped) {
+#ifdef NOTSA_DEBUG
+    // NOTSA: Use the entities found for all peds at once (See `notsa::NeighbourGrid`)
+    // Only if the scan is due, otherwise the original function just ticks the timer
+    // Debug builds only: This function isn't reversed, so the entities picked (And the closest one) may differ from the original's
+    if (g_WorldConfig.SharedScanner && m_timer.IsDue()) {
+        if (const auto nearest = CWorld::ms_NeighbourGrid.GetNearest(ped, sectorList)) {
+            m_timer.Tick();
+            SetEntities(*nearest);
+            return;
+        }
+    }
+#endif
     plugin::CallMethod<0x5FFA20, CEntityScanner*, const eRepeatSectorList, const CPed&>(this, sectorList, ped);
 }
+
+// NOTSA
+void CEntityScanner::SetEntities(std::span<CEntity* const> entities) {
+    assert(entities.size() <= MAX_NUM_ENTITIES);
+
+    // The nearest entities rarely change between scans, so only the references that differ are changed
+    for (auto&& [i, ref] : rngv::enumerate(m_apEntities)) {
+        const auto e = (size_t)i < entities.size() ? entities[i] : nullptr;
+        if (ref != e) {
+            CEntity::ChangeEntityReference(ref, e);
+        }
+    }
+
+    const auto closest = entities.empty() ? nullptr : entities.front();
+    if (m_pClosestEntityInRange != closest) {
+        CEntity::ChangeEntityReference(m_pClosestEntityInRange, closest);
+    }
+}
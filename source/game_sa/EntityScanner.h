@@ -8,6 +8,7 @@
 
 #include "RepeatSector.h"
 #include "TickCounter.h"
+#include <span>
 #include <extensions/utility.hpp>
 
 class CEntity;
@@ -51,6 +52,9 @@ protected:
 
     void Clear();
 
+    //! NOTSA: Set the entities (Sorted by distance, closest first), only changing the references that differ
+    void SetEntities(std::span<CEntity* const> entities);
+
 private: // NOTSA:
     friend void InjectHooksMain();
     static void InjectHooks();
@@ -1,5 +1,6 @@
 #include "StdInc.h"
 #include "Event.h"
+#include "EventArena.h"
 
 
 void CEvent::InjectHooks() {
@@ -7,17 +8,27 @@ void CEvent::InjectHooks() {
     RH_ScopedCategory("Events");
 
     RH_ScopedInstall(Constructor, 0x4ABFC0);
+    RH_ScopedInstall(operator new, 0x4B5620, { .locked = true }); // Events may come from the arena or the pool's chunks (See `notsa::EventArena`, `CPool::SetGrowable`)
+    RH_ScopedInstall(operator delete, 0x4B5630, { .locked = true });
     RH_ScopedInstall(CalcSoundLevelIncrement, 0x4AC050);
     RH_ScopedInstall(GetSoundLevel, 0x4B2850);
 }
 
 // 0x4B5620
-void* CEvent::operator new(unsigned) {
+void* CEvent::operator new(unsigned size) {
+    if (notsa::EventArena::IsActive()) { // NOTSA: Transient event (See `notsa::EventArena`)
+        return notsa::EventArena::Allocate(size);
+    }
+    notsa::EventArena::OnCreated(); // NOTSA
     return GetEventPool()->New();
 }
 
 // 0x4B5630
 void CEvent::operator delete(void* object) {
+    if (notsa::EventArena::Owns(object)) { // NOTSA
+        notsa::EventArena::Free(object);
+        return;
+    }
     GetEventPool()->Delete(static_cast<CEvent*>(object));
 }
 
@@ -0,0 +1,62 @@
+#include "StdInc.h"
+
+#include "EventArena.h"
+
+#include "extensions/Configs/Pools.hpp"
+
+namespace notsa {
+bool EventArena::IsActive() {
+    return s_ScopeDepth && g_PoolsConfig.TransientEventArena;
+}
+
+bool EventArena::Owns(const void* p) {
+    return rng::any_of(s_Chunks, [p](const auto& c) {
+        return c.get() <= (const byte*)p && (const byte*)p < c.get() + CHUNK_SIZE;
+    });
+}
+
+CEvent* EventArena::Clone(const CEvent& event) {
+    const Scope scope{};
+    return event.Clone();
+}
+
+void* EventArena::Allocate(size_t size) {
+    UpdateStats();
+
+    size = (size + 7) & ~(size_t)7;
+    assert(size <= CHUNK_SIZE);
+    if (s_Chunks.empty() || s_Offset + size > CHUNK_SIZE) {
+        if (!s_Chunks.empty()) { // Move on to the next chunk (Allocating it if needed)
+            s_Chunk++;
+        }
+        if (s_Chunk >= s_Chunks.size()) {
+            s_Chunks.emplace_back(std::make_unique<byte[]>(CHUNK_SIZE));
+        }
+        s_Offset = 0;
+    }
+
+    const auto p = s_Chunks[s_Chunk].get() + s_Offset;
+    s_Offset += size;
+    s_NumAlive++;
+    s_Stats.NumTransient++;
+    return p;
+}
+
+void EventArena::Free(void* p) {
+    assert(s_NumAlive > 0);
+
+    // The memory isn't reused until all events are freed, then the whole arena is rewound
+    if (--s_NumAlive == 0) {
+        s_Chunk  = 0;
+        s_Offset = 0;
+    }
+}
+
+void EventArena::UpdateStats() {
+    if (s_StatsFrame == CTimer::GetFrameCounter()) {
+        return;
+    }
+    s_StatsFrame = CTimer::GetFrameCounter();
+    s_PrevStats  = std::exchange(s_Stats, {});
+}
+}; // namespace notsa
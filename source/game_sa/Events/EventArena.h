@@ -0,0 +1,81 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+class CEvent;
+
+namespace notsa {
+/*!
+ * @brief NOTSA: Bump allocator for transient events, and counters of the events created/cloned/dropped each frame
+ *
+ * All events are allocated from the event pool (See `CEvent::operator new`), including the ones that are only
+ * cloned to be passed on and deleted right away - For example `CEventGlobalGroup::AddEventsToPed` clones every
+ * global event for every ped, just for `CEventGroup::Add` to clone it again to keep it. Each of those goes through
+ * the pool's free-list and has its slot filled (Sized for the largest event) both when it's allocated and deleted.
+ *
+ * Events allocated in a `Scope` come from here instead: they're bump allocated from chunks, `delete` only runs
+ * their destructor, and the chunks are rewound all at once as soon as none of them are alive anymore.
+ * So a `Scope` must only be used around allocations whose events are deleted before the end of the frame.
+ */
+class EventArena {
+public:
+    struct Stats {
+        uint32 NumCreated{};   //!< Number of events allocated from the pool
+        uint32 NumTransient{}; //!< Number of events allocated from the arena
+        uint32 NumCloned{};    //!< Number of events cloned into event groups (See `CEventGroup::Add`)
+        uint32 NumDropped{};   //!< Number of events not added to an event group, because it was full
+    };
+
+    //! While alive, events are allocated from the arena (If enabled)
+    class Scope {
+    public:
+        Scope() { s_ScopeDepth++; }
+        ~Scope() { s_ScopeDepth--; }
+
+        Scope(const Scope&)            = delete;
+        Scope& operator=(const Scope&) = delete;
+    };
+
+public:
+    //! Whether events should be allocated from the arena
+    static bool IsActive();
+
+    //! Whether the event was allocated from the arena
+    static bool Owns(const void* p);
+
+    //! Clone an event into the arena (It must be deleted before the end of the frame)
+    static CEvent* Clone(const CEvent& event);
+
+    static void* Allocate(size_t size);
+    static void  Free(void* p);
+
+    static void OnCreated() { UpdateStats(); s_Stats.NumCreated++; }
+    static void OnCloned() { UpdateStats(); s_Stats.NumCloned++; }
+    static void OnDropped() { UpdateStats(); s_Stats.NumDropped++; }
+
+    //! Number of events alive in the arena right now
+    static size_t GetNumAlive() { return s_NumAlive; }
+
+    //! Number of bytes reserved by the arena's chunks
+    static size_t GetCapacity() { return s_Chunks.size() * CHUNK_SIZE; }
+
+    //! Stats of the last frame
+    static const Stats& GetStats() { return s_PrevStats; }
+
+private:
+    static void UpdateStats();
+
+private:
+    static constexpr size_t CHUNK_SIZE = 16 * 1024;
+
+    static inline std::vector<std::unique_ptr<byte[]>> s_Chunks{};
+    static inline size_t                               s_Chunk{};     //!< Chunk allocated from
+    static inline size_t                               s_Offset{};    //!< Offset of the next allocation in the chunk
+    static inline size_t                               s_NumAlive{};
+    static inline uint32                               s_ScopeDepth{};
+
+    static inline Stats  s_Stats{}, s_PrevStats{};
+    static inline uint32 s_StatsFrame{};
+};
+}; // namespace notsa
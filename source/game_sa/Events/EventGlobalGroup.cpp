@@ -1,5 +1,6 @@
 #include "StdInc.h"
 #include "EventGlobalGroup.h"
+#include "EventArena.h"
 
 
 void CEventGlobalGroup::InjectHooks() {
@@ -28,7 +29,7 @@ float CEventGlobalGroup::GetSoundLevel(CEntity* entity, CVector& position) {
 // 0x4AB9C0
 void CEventGlobalGroup::AddEventsToPed(CPed* ped) {
     for (auto& event : GetEvents()) {
-        CEvent* clonedEvent = event->Clone();
+        CEvent* clonedEvent = notsa::EventArena::Clone(*event); // NOTSA: Deleted right after, so it's allocated from the arena
         ped->GetEventGroup().Add(clonedEvent, false);
         delete clonedEvent;
     }
@@ -37,7 +38,7 @@ void CEventGlobalGroup::AddEventsToPed(CPed* ped) {
 // 0x4AB8A0
 void CEventGlobalGroup::AddEventsToGroup(CPedGroup* pedGroup) {
     for (auto& event : GetEvents()) {
-        CEvent* clonedEvent = event->Clone();
+        CEvent* clonedEvent = notsa::EventArena::Clone(*event); // NOTSA: Deleted right after, so it's allocated from the arena
         pedGroup->GetIntelligence().AddEvent(clonedEvent);
         delete clonedEvent;
     }
@@ -2,6 +2,7 @@
 
 #include "Event.h"
 #include "EventGroup.h"
+#include "EventArena.h"
 
 void CEventGroup::InjectHooks() {
     RH_ScopedVirtualClass(CEventGroup, 0x85AAB0, 1);
@@ -72,10 +73,12 @@ CEvent* CEventGroup::Add(CEvent* event, bool bValid) {
     }
 
     if (m_count >= TOTAL_EVENTS_PER_EVENTGROUP) {
+        notsa::EventArena::OnDropped(); // NOTSA
         return nullptr;
     }
 
     const auto clonedEvent = event->Clone();
+    notsa::EventArena::OnCloned(); // NOTSA
     clonedEvent->m_bValid  = bValid;
     if (m_pPed) {
         clonedEvent->ReportCriminalEvent(m_pPed);
@@ -11,6 +11,7 @@
 #include "Occlusion.h"
 #include "PedType.h"
 #include "ColHelpers.h"
+#include "ColTriangleBVH.h"
 #include "TempColModels.h"
 #include "PlantMgr.h"
 #include "StuntJumpManager.h"
@@ -525,6 +526,74 @@ bool CFileLoader::LoadCollisionFile(uint8* buff, uint32 buffSize, uint8 colId) {
 
         auto& cm = *mi->GetColModel();
         LoadCollisionModelAnyVersion(h, buffIt + sizeof(FileHeader), cm);
+        if (cm.m_pColData) {
+            notsa::ColTriangleBVH::Build(*cm.m_pColData); // NOTSA
+        }
+
+        cm.m_nColSlot = colId;
+        if (mi->GetModelType() == MODEL_INFO_ATOMIC) {
+            CPlantMgr::SetPlantFriendlyFlagInAtomicMI(static_cast<CAtomicModelInfo*>(mi));
+        }
+    }
+
+    return true;
+}
+
+// NOTSA
+void CFileLoader::DecodeCollisionFile(uint8* buff, uint32 buffSize, DecodedColFile& out) {
+    using namespace ColHelpers;
+
+    auto fileTotalSize{0u};
+    for (auto buffPos = 0u; buffPos < buffSize; buffPos += fileTotalSize) {
+        const auto buffRemainingSize = buffSize - buffPos;
+        const auto buffIt            = &buff[buffPos];
+
+        if (buffRemainingSize < sizeof(FileHeader::FileInfo) || !reinterpret_cast<FileHeader::FileInfo*>(buffIt)->IsValid()) {
+            return; // No more data (Or just padding)
+        }
+
+        const auto& h = *reinterpret_cast<FileHeader*>(buffIt);
+        fileTotalSize = h.GetTotalSize();
+
+        assert(fileTotalSize <= buffRemainingSize && "Not enough data in buffer for col data");
+
+        auto& d = out.emplace_back();
+        d.Header = &h;
+        LoadCollisionModelAnyVersion(h, buffIt + sizeof(FileHeader), d.ColModel);
+    }
+}
+
+// NOTSA
+bool CFileLoader::LinkCollisionFile(DecodedColFile& decoded, uint8 colId) {
+    for (auto& d : decoded) {
+        const auto& h = *d.Header;
+
+        // Same as in `LoadCollisionFile`
+        auto mi = IsModelDFF(h.modelId) ? CModelInfo::GetModelInfo(h.modelId) : nullptr;
+        if (!mi || mi->m_nKey != CKeyGen::GetUppercaseKey(h.modelName)) {
+            auto colDef = CColStore::GetInSlot(colId);
+            mi = CModelInfo::GetModelInfo(h.modelName, colDef->m_nModelIdStart, colDef->m_nModelIdEnd);
+        }
+
+        if (!mi || !mi->bIsLod) {
+            continue;
+        }
+
+        if (!mi->GetColModel()) {
+            mi->SetColModel(new CColModel, true);
+        }
+
+        // Move the data over (These are the fields `LoadCollisionModel*` sets)
+        auto& cm = *mi->GetColModel();
+        cm.RemoveCollisionVolumes(); // Free the old data first (If any), otherwise it'd leak
+        cm.m_boundBox              = d.ColModel.m_boundBox;
+        cm.m_boundSphere           = d.ColModel.m_boundSphere;
+        cm.m_bHasCollisionVolumes  = d.ColModel.m_bHasCollisionVolumes;
+        cm.m_bIsSingleColDataAlloc = d.ColModel.m_bIsSingleColDataAlloc;
+        cm.m_pColData              = std::exchange(d.ColModel.m_pColData, nullptr);
+        if (cm.m_pColData) {
+            notsa::ColTriangleBVH::Build(*cm.m_pColData); // Same as in `LoadCollisionFile` (Here, on the main thread, as the table isn't thread-safe)
+        }
 
         cm.m_nColSlot = colId;
         if (mi->GetModelType() == MODEL_INFO_ATOMIC) {
@@ -6,11 +6,16 @@
 */
 #pragma once
 
+#include <deque>
+
 #include "RenderWare.h"
 
 #include "FileMgr.h"
+#include "ColModel.h"
 
-class CColModel;
+namespace ColHelpers {
+struct FileHeader;
+};
 class CBoundingBox;
 class CFileCarGenerator;
 class CEntity;
@@ -109,6 +114,30 @@ public:
     static void LoadCollisionModelVer3(uint8* buffer, uint32 fileSize, CColModel& cm, const char* modelName);
     static void LoadCollisionModelVer4(uint8* buffer, uint32 fileSize, CColModel& cm, const char* modelName);
 
+    //! NOTSA: A col model decoded by `DecodeCollisionFile`, that is yet to be linked to its model info
+    struct DecodedColModel {
+        const ColHelpers::FileHeader* Header{}; //!< Points into the data passed to `DecodeCollisionFile`
+        CColModel                     ColModel{};
+
+        DecodedColModel() = default;
+        DecodedColModel(const DecodedColModel&) = delete; // `CColModel` can't be copied safely
+    };
+    using DecodedColFile = std::deque<DecodedColModel>;
+
+    /*!
+     * @notsa
+     * @brief First half of `LoadCollisionFile`: Decode all col models in the buffer. Doesn't touch any global state, so it's safe to call from any thread.
+     * @brief The decoded models point into `data`, so it must be kept alive until they're linked.
+     */
+    static void DecodeCollisionFile(uint8* data, uint32 dataSize, DecodedColFile& out);
+
+    /*!
+     * @notsa
+     * @brief Second half of `LoadCollisionFile`: Link the decoded models to their model infos. Main thread only.
+     * @brief Models that weren't linked are left in `decoded` (and are freed with it)
+     */
+    static bool LinkCollisionFile(DecodedColFile& decoded, uint8 colId);
+
     static void LoadCullZone(const char* line);
     static void LoadEntryExit(const char* line);
     static void LoadGarage(const char* line);
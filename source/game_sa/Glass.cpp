@@ -3,6 +3,7 @@
 #include "Glass.h"
 #include "FallingGlassPane.h"
 #include "Shadows.h"
+#include "ColTriangleBVH.h"
 
 void CGlass::InjectHooks() {
     RH_ScopedClass(CGlass);
@@ -550,11 +551,19 @@ void CGlass::BreakGlassPhysically(CVector point, float radius) {
             };
             CCollision::CalculateTrianglePlanes(colModel);
 
+            const auto TestTri = [&](uint16 tri) {
+                return CCollision::TestSphereTriangle(sphere, colData->m_pVertices, colData->m_pTriangles[tri], colData->m_pTrianglePlanes[tri]);
+            };
+
             // TODO / NOTE: Shouldn't the loop stop the first time it hits a triangle? Unsure why they didn't do it like that?
             bool hasHit{};
-            for (auto tri = 0u; tri < colModel->GetTriCount(); tri++) {
-                if (CCollision::TestSphereTriangle(sphere, colData->m_pVertices, colData->m_pTriangles[tri], colData->m_pTrianglePlanes[tri])) {
-                    hasHit = true;
+            if (const auto bvh = notsa::ColTriangleBVH::Get(*colData)) { // NOTSA: Stops at the first hit, the result is the same
+                hasHit = bvh->TestSphere(sphere, TestTri);
+            } else {
+                for (auto tri = 0u; tri < colModel->GetTriCount(); tri++) {
+                    if (TestTri(tri)) {
+                        hasHit = true;
+                    }
                 }
             }
             if (!hasHit)
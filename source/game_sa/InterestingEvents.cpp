@@ -1,6 +1,7 @@
 #include "StdInc.h"
 
 #include "InterestingEvents.h"
+#include "LineOfSightBatch.h"
 
 auto& g_InterestingEvents = StaticRef<CInterestingEvents>(0xC0B058);
 
@@ -305,15 +306,26 @@ void CInterestingEvents::InvalidateEvent(const TInterestingEvent* event) {
 // 0x6029C0
 void CInterestingEvents::InvalidateNonVisibleEvents() {
     const auto& camPos = CCamera::GetActiveCamera().m_vecSource;
+
+    // NOTSA: Test all events at once instead of calling `CWorld::GetIsLineOfSightClear` for each
+    static notsa::LineOfSightBatch s_Batch{};
+    s_Batch.Clear();
+    int32 rayEventIdx[MAX_INTERESTING_EVENTS]{};
     for (auto i = 0; i < MAX_INTERESTING_EVENTS; i++) {
-        TInterestingEvent& event = m_Events[i];
-        if (!event.entity)
+        if (!m_Events[i].entity)
             continue;
 
-        CVector pos = event.entity->GetPosition();
-        if (CWorld::GetIsLineOfSightClear(camPos, pos, true, false, false, false, false, true, false))
+        rayEventIdx[s_Batch.GetRays().size()] = i;
+        s_Batch.Add(camPos, m_Events[i].entity->GetPosition(), notsa::LineOfSightBatch::GetEntityTypeMask(true, false, false, false, false)).DoSeeThroughCheck = true;
+    }
+    s_Batch.TestClear();
+
+    for (auto r = 0u; r < s_Batch.GetRays().size(); r++) {
+        if (!s_Batch.GetRays()[r].HasHit)
             continue;
 
+        const auto i = rayEventIdx[r];
+        TInterestingEvent& event = m_Events[i];
         event.time = 0;
         CEntity::SafeCleanUpRef(event.entity);
         if (m_nInterestingEvent == i) {
@@ -0,0 +1,256 @@
+#include "StdInc.h"
+
+#include "LineOfSightBatch.h"
+
+#include <bit>
+
+namespace notsa {
+namespace {
+constexpr float CORNER_EPSILON = 1e-5f; //!< Lines that pass this close to the corner of a sector go through both neighbouring sectors
+constexpr float RADIUS_EPSILON = 0.01f; //!< So that float errors never cull a ray that'd hit
+};
+
+LineOfSightBatch::Ray& LineOfSightBatch::Add(const CVector& origin, const CVector& target, uint8 entityTypes, std::initializer_list<const CEntity*> ignored) {
+    auto& ray = m_Rays.emplace_back();
+    ray.Origin       = origin;
+    ray.Target       = target;
+    ray.EntityTypes  = entityTypes;
+    ray.IgnoredBegin = m_Ignored.size();
+    m_Ignored.insert(m_Ignored.end(), ignored.begin(), ignored.end());
+    ray.IgnoredEnd   = m_Ignored.size();
+    return ray;
+}
+
+void LineOfSightBatch::Clear() {
+    m_Rays.clear();
+    m_Ignored.clear();
+}
+
+bool LineOfSightBatch::IsRayNear(const Ray& ray, const CVector& centre, float radius) {
+    const auto toCentre = centre - ray.Origin;
+    const auto t        = std::clamp(DotProduct(toCentre, ray.Dir) * ray.InvLenSq, 0.f, 1.f);
+    return (toCentre - ray.Dir * t).SquaredMagnitude() <= sq(radius);
+}
+
+bool LineOfSightBatch::IsIgnored(const Ray& ray, const CEntity* entity) const {
+    return std::find(m_Ignored.begin() + ray.IgnoredBegin, m_Ignored.begin() + ray.IgnoredEnd, entity) != m_Ignored.begin() + ray.IgnoredEnd;
+}
+
+LineOfSightBatch::RayMask LineOfSightBatch::GetSectorRays(int32 x, int32 y) const {
+    const auto index = (uint32)(std::clamp(y, 0, MAX_SECTORS_Y - 1) * MAX_SECTORS_X + std::clamp(x, 0, MAX_SECTORS_X - 1));
+    const auto it    = rng::lower_bound(m_Sectors, index, {}, &SectorRays::Index);
+    return it != m_Sectors.end() && it->Index == index
+        ? it->Rays
+        : 0;
+}
+
+template<typename Fn>
+void LineOfSightBatch::WalkSectors(const Ray& ray, Fn&& fn) {
+    const auto x0 = CWorld::GetSectorfX(ray.Origin.x), y0 = CWorld::GetSectorfY(ray.Origin.y);
+    const auto x1 = CWorld::GetSectorfX(ray.Target.x), y1 = CWorld::GetSectorfY(ray.Target.y);
+
+    const auto IsInMap = [](float x, float y) {
+        return x >= 0.f && x < (float)MAX_SECTORS_X && y >= 0.f && y < (float)MAX_SECTORS_Y;
+    };
+    if (!IsInMap(x0, y0) || !IsInMap(x1, y1)) {
+        // Outside of the map everything's in the sectors at the edges (See `CWorld::GetSector`, `CEntity::Add`).
+        // The clamped line isn't straight anymore, but it's always within the rect of the clamped end points.
+        const auto ClampX = [](float x) { return std::clamp((int32)std::floor(x), 0, MAX_SECTORS_X - 1); };
+        const auto ClampY = [](float y) { return std::clamp((int32)std::floor(y), 0, MAX_SECTORS_Y - 1); };
+        CWorld::IterateSectors(ClampX(std::min(x0, x1)), ClampY(std::min(y0, y1)), ClampX(std::max(x0, x1)), ClampY(std::max(y0, y1)), [&](int32 x, int32 y) {
+            fn(x, y);
+            return true;
+        });
+        return;
+    }
+
+    // Grid traversal (Amanatides & Woo) - `nextX/Y` is the fraction of the line at which the next sector boundary on that axis is crossed
+    auto       x = (int32)std::floor(x0), y = (int32)std::floor(y0);
+    const auto endX = (int32)std::floor(x1), endY = (int32)std::floor(y1);
+    const auto dx = x1 - x0, dy = y1 - y0;
+    const auto stepX = dx >= 0.f ? 1 : -1, stepY = dy >= 0.f ? 1 : -1;
+    const auto deltaX = dx != 0.f ? std::abs(1.f / dx) : FLT_MAX;
+    const auto deltaY = dy != 0.f ? std::abs(1.f / dy) : FLT_MAX;
+    auto       nextX = dx != 0.f ? (dx > 0.f ? (float)(x + 1) - x0 : x0 - (float)x) * deltaX : FLT_MAX;
+    auto       nextY = dy != 0.f ? (dy > 0.f ? (float)(y + 1) - y0 : y0 - (float)y) * deltaY : FLT_MAX;
+
+    fn(x, y);
+    for (auto n = std::abs(endX - x) + std::abs(endY - y); n > 0; n--) {
+        if (x != endX && y != endY && std::abs(nextX - nextY) < CORNER_EPSILON) {
+            // Going through a corner, do both neighbours, so nothing's missed because of float errors
+            fn(x + stepX, y);
+            fn(x, y + stepY);
+            x += stepX, nextX += deltaX;
+            y += stepY, nextY += deltaY;
+            n--;
+        } else if (y == endY || (x != endX && nextX < nextY)) {
+            x += stepX, nextX += deltaX;
+        } else {
+            y += stepY, nextY += deltaY;
+        }
+        fn(x, y);
+    }
+}
+
+template<typename PtrListType>
+void LineOfSightBatch::ProcessSectorList(PtrListType& list, uint32 first) {
+    for (auto* const entity : list) {
+        if (entity->IsScanCodeCurrent()) {
+            continue;
+        }
+        entity->SetCurrentScanCode();
+        s_Stats.NumEntities++;
+
+        if (!entity->GetUsesCollision() || entity == CWorld::pIgnoreEntity) {
+            continue;
+        }
+
+        auto rays = m_RaysByType[entity->GetType()] & m_Unresolved;
+        if (!rays) {
+            continue;
+        }
+
+        // Bounding sphere of what `CCollision` tests first (The col model's bounding box)
+        const auto cm = entity->GetColModel();
+        if (!cm) {
+            continue;
+        }
+        const auto& bb = cm->GetBoundingBox();
+        CVector     centre{};
+        entity->TransformFromObjectSpace(centre, bb.GetCenter());
+        const auto radius = bb.GetSize().Magnitude() / 2.f + RADIUS_EPSILON;
+
+        // Only rays that go through a sector the entity is in could hit it
+        RayMask nearRays{};
+        CWorld::IterateSectors(
+            std::clamp(CWorld::GetSectorX(centre.x - radius), 0, MAX_SECTORS_X - 1),
+            std::clamp(CWorld::GetSectorY(centre.y - radius), 0, MAX_SECTORS_Y - 1),
+            std::clamp(CWorld::GetSectorX(centre.x + radius), 0, MAX_SECTORS_X - 1),
+            std::clamp(CWorld::GetSectorY(centre.y + radius), 0, MAX_SECTORS_Y - 1),
+            [&](int32 x, int32 y) {
+                nearRays |= GetSectorRays(x, y);
+                return true;
+            }
+        );
+        rays &= nearRays;
+
+        std::optional<bool> isIgnoredByCamera{};
+        for (; rays; rays &= rays - 1) {
+            const auto idx = (uint32)std::countr_zero(rays);
+            auto&      ray = m_Rays[first + idx];
+            if (IsIgnored(ray, entity) || !IsRayNear(ray, centre, radius)) {
+                continue;
+            }
+
+            if (ray.DoCameraIgnoreCheck && entity->GetIsTypeObject()) {
+                if (!isIgnoredByCamera) {
+                    isIgnoredByCamera = CWorld::CameraToIgnoreThisObject(entity);
+                }
+                if (*isIgnoredByCamera) {
+                    continue;
+                }
+            }
+
+            s_Stats.NumNarrowTests++;
+            if (CCollision::TestLineOfSight(ray.Line, entity->GetMatrix(), *cm, ray.DoSeeThroughCheck, false)) {
+                ray.HasHit    = true;
+                ray.HitEntity = entity;
+                m_Unresolved &= ~((RayMask)1 << idx);
+            }
+        }
+
+        if (!m_Unresolved) {
+            return;
+        }
+    }
+}
+
+void LineOfSightBatch::RunPass(uint32 first, uint32 num) {
+    // Find the sectors of the rays (And which rays go through each)
+    m_Sectors.clear();
+    rng::fill(m_RaysByType, 0);
+    for (auto i = 0u; i < num; i++) {
+        const auto& ray = m_Rays[first + i];
+        const auto  bit = (RayMask)1 << i;
+        for (auto type = 0; type < ENTITY_TYPE_NOTINPOOLS; type++) {
+            if (ray.EntityTypes & (1 << type)) {
+                m_RaysByType[type] |= bit;
+            }
+        }
+        WalkSectors(ray, [&](int32 x, int32 y) {
+            m_Sectors.push_back({ .Index = (uint32)(y * MAX_SECTORS_X + x), .Rays = bit });
+        });
+    }
+    rng::sort(m_Sectors, {}, &SectorRays::Index);
+    size_t numUnique = 0;
+    for (const auto& sr : m_Sectors) {
+        if (numUnique && m_Sectors[numUnique - 1].Index == sr.Index) {
+            m_Sectors[numUnique - 1].Rays |= sr.Rays;
+        } else {
+            m_Sectors[numUnique++] = sr;
+        }
+    }
+    m_Sectors.resize(numUnique);
+    s_Stats.NumSectors += m_Sectors.size();
+
+    m_Unresolved = num == MAX_RAYS_PER_PASS ? ~(RayMask)0 : ((RayMask)1 << num) - 1;
+
+    // Now walk them, each entity is only processed once for all rays
+    CWorld::AdvanceCurrentScanCode();
+    for (const auto& sr : m_Sectors) {
+        if (!(sr.Rays & m_Unresolved)) {
+            continue;
+        }
+
+        const auto x = (int32)(sr.Index % MAX_SECTORS_X), y = (int32)(sr.Index / MAX_SECTORS_X);
+        auto& sector       = CWorld::GetSector(x, y);
+        auto& repeatSector = CWorld::GetRepeatSector(x, y);
+
+        const auto IsTested = [&](eEntityType type) {
+            return (sr.Rays & m_RaysByType[type]) != 0;
+        };
+        if (IsTested(ENTITY_TYPE_BUILDING)) {
+            ProcessSectorList(sector.Buildings, first);
+        }
+        if (IsTested(ENTITY_TYPE_VEHICLE)) {
+            ProcessSectorList(repeatSector.Vehicles, first);
+        }
+        if (IsTested(ENTITY_TYPE_PED)) {
+            ProcessSectorList(repeatSector.Peds, first);
+        }
+        if (IsTested(ENTITY_TYPE_OBJECT)) {
+            ProcessSectorList(repeatSector.Objects, first);
+        }
+        if (IsTested(ENTITY_TYPE_DUMMY)) {
+            ProcessSectorList(sector.Dummies, first);
+        }
+
+        if (!m_Unresolved) {
+            break; // All rays hit something already
+        }
+    }
+}
+
+void LineOfSightBatch::TestClear() {
+    ZoneScoped;
+
+    for (auto& ray : m_Rays) {
+        assert(!ray.Origin.HasNanOrInf() && !ray.Target.HasNanOrInf());
+
+        ray.HasHit    = false;
+        ray.HitEntity = nullptr;
+
+        ray.Line = { ray.Origin, ray.Target };
+        ray.Dir  = ray.Target - ray.Origin;
+        const auto lenSq = ray.Dir.SquaredMagnitude();
+        ray.InvLenSq = lenSq > 0.f ? 1.f / lenSq : 0.f;
+    }
+
+    for (auto first = 0u; first < m_Rays.size(); first += MAX_RAYS_PER_PASS) {
+        RunPass(first, std::min<uint32>(m_Rays.size() - first, MAX_RAYS_PER_PASS));
+    }
+
+    s_Stats.NumRays += m_Rays.size();
+    s_Stats.NumHits += rng::count_if(m_Rays, &Ray::HasHit);
+}
+}; // namespace notsa
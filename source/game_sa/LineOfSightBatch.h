@@ -0,0 +1,134 @@
+#pragma once
+
+#include <initializer_list>
+#include <span>
+#include <vector>
+
+#include "Vector.h"
+#include "ColLine.h"
+#include "eEntityType.h"
+
+class CEntity;
+
+namespace notsa {
+/*!
+ * @brief NOTSA: Many line of sight tests done at once, see `TestClear`.
+ *
+ * `CWorld::GetIsLineOfSightClear` walks the sectors along the line and tests every entity in them,
+ * so rays close to each other (Eg.: From the camera to all interesting events, see `CInterestingEvents::InvalidateNonVisibleEvents`) walk the same lists over and over again.
+ * Here the sectors along all rays are walked once, and each entity in them is only tested against the rays that
+ * pass through one of the sectors it's in and come close to its bounding box (Sharing the transforms, etc).
+ *
+ * Usage:
+ * ```
+ * notsa::LineOfSightBatch batch{};
+ * for (auto& ped : peds) {
+ *     batch.Add(origin, ped.GetPosition(), LineOfSightBatch::GetEntityTypeMask(true, false, false, true, false), { &ped });
+ * }
+ * batch.TestClear();
+ * for (const auto& ray : batch.GetRays()) { ... ray.HasHit ... }
+ * ```
+ */
+class LineOfSightBatch {
+public:
+    //! Max. number of rays processed at once (The rays of a sector are a bitmask), more rays are done in multiple passes
+    static constexpr uint32 MAX_RAYS_PER_PASS = 64;
+
+    struct Ray {
+        // Input
+        CVector Origin{};
+        CVector Target{};
+        uint8   EntityTypes{};         //!< Bitmask of `1 << eEntityType`, see `GetEntityTypeMask`
+        bool    DoSeeThroughCheck{};
+        bool    DoCameraIgnoreCheck{}; //!< Only for objects (Same as vanilla)
+
+        // Output
+        bool     HasHit{};
+        CEntity* HitEntity{}; //!< The first entity found to block the line (Not necessarily the closest)
+
+    private:
+        friend class LineOfSightBatch;
+
+        CColLine Line{};
+        CVector  Dir{};           //!< `Target - Origin`
+        float    InvLenSq{};      //!< `1 / Dir.SquaredMagnitude()` (0 if the line has no length)
+        uint32   IgnoredBegin{};  //!< Range of `m_Ignored`
+        uint32   IgnoredEnd{};
+    };
+
+    struct Stats {
+        uint64 NumRays{};        //!< Number of rays processed
+        uint64 NumSectors{};     //!< Number of (unique) sectors walked
+        uint64 NumEntities{};    //!< Number of entities visited in those sectors
+        uint64 NumNarrowTests{}; //!< Number of ray vs col model tests (In vanilla it'd be at least `NumEntities` for each ray)
+        uint64 NumHits{};        //!< Number of rays that hit something
+    };
+
+public:
+    static constexpr uint8 GetEntityTypeMask(bool buildings, bool vehicles, bool peds, bool objects, bool dummies) {
+        return (buildings ? 1 << ENTITY_TYPE_BUILDING : 0)
+             | (vehicles  ? 1 << ENTITY_TYPE_VEHICLE : 0)
+             | (peds      ? 1 << ENTITY_TYPE_PED : 0)
+             | (objects   ? 1 << ENTITY_TYPE_OBJECT : 0)
+             | (dummies   ? 1 << ENTITY_TYPE_DUMMY : 0);
+    }
+
+    /*!
+     * @brief Add a ray
+     * @param entityTypes See `Ray::EntityTypes`
+     * @param ignored     Entities this ray should ignore (`CWorld::pIgnoreEntity` is ignored by all rays too)
+     * @return The ray, to set the rest of the options (Only valid until the next `Add`)
+     */
+    Ray& Add(const CVector& origin, const CVector& target, uint8 entityTypes, std::initializer_list<const CEntity*> ignored = {});
+
+    //! Same as `CWorld::GetIsLineOfSightClear` for all rays - `Ray::HasHit` is set if the line isn't clear
+    void TestClear();
+
+    //! Remove all rays
+    void Clear();
+
+    std::span<Ray>       GetRays() { return m_Rays; }
+    std::span<const Ray> GetRays() const { return m_Rays; }
+
+    static const Stats& GetStats() { return s_Stats; }
+    static void         ResetStats() { s_Stats = {}; }
+
+private:
+    using RayMask = uint64;
+
+    void RunPass(uint32 first, uint32 num);
+
+    template<typename PtrListType>
+    void ProcessSectorList(PtrListType& list, uint32 first);
+
+    //! Call `fn(x, y)` for all sectors the ray passes through (Some might be called multiple times)
+    template<typename Fn>
+    static void WalkSectors(const Ray& ray, Fn&& fn);
+
+    //! Whenever the ray comes closer than `radius` to `centre`
+    static bool IsRayNear(const Ray& ray, const CVector& centre, float radius);
+
+    bool IsIgnored(const Ray& ray, const CEntity* entity) const;
+
+private:
+    //! Rays passing through a sector
+    struct SectorRays {
+        uint32  Index{}; //!< `y * MAX_SECTORS_X + x`
+        RayMask Rays{};
+    };
+
+    //! Rays of this pass passing through the sector, 0 if none (Coordinates are clamped the same way as in `CWorld::GetSector`)
+    RayMask GetSectorRays(int32 x, int32 y) const;
+
+private:
+    std::vector<Ray>            m_Rays{};
+    std::vector<const CEntity*> m_Ignored{};
+
+    // State of the current pass
+    std::vector<SectorRays> m_Sectors{};                             //!< Sorted by `Index`, unique
+    RayMask                 m_RaysByType[ENTITY_TYPE_NOTINPOOLS]{}; //!< Rays that test each entity type
+    RayMask                 m_Unresolved{};                          //!< Rays that haven't hit anything yet
+
+    static inline Stats s_Stats{};
+};
+}; // namespace notsa
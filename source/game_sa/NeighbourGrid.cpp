@@ -0,0 +1,227 @@
+#include "StdInc.h"
+
+#include "NeighbourGrid.h"
+
+#include <execution>
+
+#include "extensions/Configs/World.hpp"
+
+namespace notsa {
+void NeighbourGrid::Update() {
+    if (m_Frame != CTimer::GetFrameCounter()) {
+        Build();
+    }
+}
+
+std::optional<std::span<CEntity* const>> NeighbourGrid::GetNearest(const CPed& ped, eRepeatSectorList list) {
+    assert(list == REPEATSECTOR_VEHICLES || list == REPEATSECTOR_PEDS);
+
+    Update();
+
+    // The ped's slot may have been reused since the sweep, so check by reference (Not just by the pointer)
+    const auto idx = (size_t)GetPedPool()->GetIndex(&ped);
+    const auto l   = (size_t)list;
+    if (idx >= m_Results.size() || !m_Results[idx].IsDue[l] || GetPedPool()->GetAtRef(m_Results[idx].PedRef) != &ped) {
+        m_Stats.NumMisses++;
+        return std::nullopt;
+    }
+    m_Stats.NumHits++;
+
+    // Entities may have been deleted since the sweep (And their slots maybe reused already), drop those (The rest are still the nearest)
+    auto& r   = m_Results[idx];
+    auto  num = 0u;
+    for (auto i = 0u; i < r.NumNearest[l]; i++) {
+        const auto e   = r.Nearest[l][i];
+        const auto ref = r.NearestRefs[l][i];
+        if (list == REPEATSECTOR_VEHICLES ? GetVehiclePool()->GetAtRef(ref) == e : GetPedPool()->GetAtRef(ref) == e) {
+            r.Nearest[l][num]       = e;
+            r.NearestRefs[l][num++] = ref;
+        }
+    }
+    r.NumNearest[l] = (uint8)num;
+
+    return std::span{ r.Nearest[l].data(), num };
+}
+
+void NeighbourGrid::Clear() {
+    for (auto& items : m_Items) {
+        items.clear();
+    }
+    m_Results.clear();
+    m_Frame = (uint32)-1;
+}
+
+void NeighbourGrid::ResetStats() {
+    m_Stats.NumBuilds     = 0;
+    m_Stats.NumHits       = 0;
+    m_Stats.NumMisses     = 0;
+    m_Stats.NumVerified   = 0;
+    m_Stats.NumMismatches = 0;
+}
+
+void NeighbourGrid::Build() {
+    ZoneScoped;
+
+    m_Frame = CTimer::GetFrameCounter();
+    m_Range = std::max(g_WorldConfig.SharedScannerRange, 1.f);
+    m_Stats.NumBuilds++;
+
+    // Bin the entities of the lists (Same ones the vanilla scan looks at)
+    for (auto& items : m_Items) {
+        items.clear();
+    }
+    const auto Bin = [this](auto& list, eRepeatSectorList l) {
+        for (auto* const e : list) {
+            const auto& pos = e->GetPosition();
+            const auto  ref = l == REPEATSECTOR_VEHICLES ? GetVehiclePool()->GetRef(e->AsVehicle()) : GetPedPool()->GetRef(e->AsPed());
+            m_Items[l].push_back({ .Cell = GetCell(GetCellCoord(pos.x), GetCellCoord(pos.y)), .Pos = pos, .Entity = e, .Ref = ref });
+        }
+    };
+    for (auto y = 0; y < MAX_REPEAT_SECTORS_Y; y++) {
+        for (auto x = 0; x < MAX_REPEAT_SECTORS_X; x++) {
+            auto& rs = CWorld::GetRepeatSector(x, y);
+            Bin(rs.Vehicles, REPEATSECTOR_VEHICLES);
+            Bin(rs.Peds, REPEATSECTOR_PEDS);
+        }
+    }
+    for (auto& items : m_Items) {
+        rng::sort(items, {}, &Item::Cell);
+    }
+    m_Stats.NumVehicles = (uint32)m_Items[REPEATSECTOR_VEHICLES].size();
+    m_Stats.NumPeds     = (uint32)m_Items[REPEATSECTOR_PEDS].size();
+
+    // Find the nearest entities of every ped whose scanners are due (The rest won't scan this frame)
+    auto& pool = *GetPedPool();
+    m_Results.assign(pool.GetSize(), {});
+    m_Stats.NumSwept = 0;
+    for (auto&& [idx, ped] : pool.GetAllValidWithIndex()) {
+        if (!ped.IsAlive()) { // Dead peds don't scan (See `CPedScanner::ScanForPedsInRange`)
+            continue;
+        }
+        auto& r     = m_Results[idx];
+        auto& intel = *ped.GetIntelligence();
+
+        // Peds in a vehicle only scan for vehicles if they're mission peds (See `CVehicleScanner::ScanForVehiclesInRange`)
+        const auto isScanningVehicles  = !ped.m_pVehicle || !ped.bInVehicle || ped.IsCreatedByMission();
+        r.IsDue[REPEATSECTOR_VEHICLES] = isScanningVehicles && intel.GetVehicleScanner().GetTimer()->IsDue();
+        r.IsDue[REPEATSECTOR_PEDS]     = intel.GetPedScanner().GetTimer()->IsDue();
+        if (!r.IsDue[REPEATSECTOR_VEHICLES] && !r.IsDue[REPEATSECTOR_PEDS]) {
+            continue;
+        }
+        r.Ped    = &ped;
+        r.PedRef = pool.GetRef(&ped);
+        m_Stats.NumSwept++;
+    }
+    Sweep(m_Results, g_WorldConfig.SharedScannerParallel);
+
+    if (g_WorldConfig.SharedScannerVerify) {
+        Verify();
+    }
+}
+
+void NeighbourGrid::Sweep(std::span<Result> results, bool parallel) const {
+    ZoneScoped;
+
+    const auto Find = [this](Result& r) {
+        if (r.Ped) {
+            FindNearest(*r.Ped, r);
+        }
+    };
+    if (parallel) {
+        std::for_each(std::execution::par, results.begin(), results.end(), Find);
+    } else {
+        rng::for_each(results, Find);
+    }
+}
+
+void NeighbourGrid::Verify() {
+    ZoneScoped;
+
+    // Find the nearest entities of every swept ped by testing all of them (Not just the ones in the neighbouring cells),
+    // the distances of the lists must be the same (The order of entities at the same distance may differ)
+    m_Stats.NumVerified++;
+    const auto rangeSq = sq(m_Range);
+    std::vector<float> expected{}, actual{};
+    for (auto&& [i, r] : rngv::enumerate(m_Results)) {
+        if (!r.Ped) {
+            continue;
+        }
+        const auto& pos = r.Ped->GetPosition();
+        const auto IsSame = [&](size_t l) {
+            if (!r.IsDue[l]) {
+                return true;
+            }
+            expected.clear();
+            for (const auto& item : m_Items[l]) {
+                if (const auto d = (item.Pos - pos).SquaredMagnitude(); item.Entity != r.Ped && d <= rangeSq) {
+                    expected.push_back(d);
+                }
+            }
+            rng::sort(expected);
+            expected.resize(std::min(expected.size(), MAX_NUM_ENTITIES));
+
+            actual.clear();
+            for (const auto e : std::span{ r.Nearest[l] }.first(r.NumNearest[l])) {
+                actual.push_back((e->GetPosition() - pos).SquaredMagnitude());
+            }
+            return actual == expected;
+        };
+        if (IsSame(REPEATSECTOR_VEHICLES) && IsSame(REPEATSECTOR_PEDS)) {
+            continue;
+        }
+        if (m_Stats.NumMismatches++ == 0) { // Only the first one is logged, the rest are in the stats
+            NOTSA_LOG_WARN("Neighbour sweep differs from the brute-force search (Frame: {}, Ped: {})", m_Frame, i);
+        }
+    }
+}
+
+void NeighbourGrid::FindNearest(const CPed& ped, Result& result) const {
+    const auto& pos     = ped.GetPosition();
+    const auto  cx      = GetCellCoord(pos.x), cy = GetCellCoord(pos.y);
+    const auto  rangeSq = sq(m_Range);
+    for (auto l = 0u; l < NUM_LISTS; l++) {
+        if (!result.IsDue[l]) {
+            continue;
+        }
+        auto& nearest = result.Nearest[l];
+        auto& refs    = result.NearestRefs[l];
+        auto& num     = result.NumNearest[l];
+
+        // Insertion sort by distance, keeping the nearest `MAX_NUM_ENTITIES` only
+        std::array<float, MAX_NUM_ENTITIES> distSq{};
+        num = 0;
+        for (auto y = cy - 1; y <= cy + 1; y++) {
+            for (auto x = cx - 1; x <= cx + 1; x++) {
+                const auto [begin, end] = rng::equal_range(m_Items[l], GetCell(x, y), {}, &Item::Cell);
+                for (const auto& item : rng::subrange{ begin, end }) {
+                    if (item.Entity == &ped) {
+                        continue;
+                    }
+                    const auto d = (item.Pos - pos).SquaredMagnitude();
+                    if (d > rangeSq || num == MAX_NUM_ENTITIES && d >= distSq[num - 1]) {
+                        continue;
+                    }
+                    auto i = std::min<uint32>(num, MAX_NUM_ENTITIES - 1);
+                    for (; i > 0 && distSq[i - 1] > d; i--) {
+                        distSq[i]  = distSq[i - 1];
+                        nearest[i] = nearest[i - 1];
+                        refs[i]    = refs[i - 1];
+                    }
+                    distSq[i]  = d;
+                    nearest[i] = item.Entity;
+                    refs[i]    = item.Ref;
+                    num        = (uint8)std::min<uint32>(num + 1, MAX_NUM_ENTITIES);
+                }
+            }
+        }
+    }
+}
+
+uint32 NeighbourGrid::GetCell(int32 x, int32 y) const {
+    return ((uint32)(uint16)x << 16) | (uint32)(uint16)y;
+}
+
+int32 NeighbourGrid::GetCellCoord(float x) const {
+    return (int32)std::floor(x / m_Range);
+}
+}; // namespace notsa
@@ -0,0 +1,98 @@
+#pragma once
+
+#include <array>
+#include <optional>
+#include <span>
+#include <vector>
+
+#include "Vector.h"
+#include "RepeatSector.h"
+#include "EntityScanner.h"
+
+class CEntity;
+class CPed;
+
+namespace notsa {
+/*!
+ * @brief NOTSA: Nearest vehicles and peds of every ped, found once per frame for all peds at once (See `CEntityScanner`)
+ *
+ * The scanners of every ped (`CVehicleScanner` and `CPedScanner`) walk the repeat sector lists around it, and sort what they find by distance,
+ * so peds near each other walk the same lists and calculate the same distances.
+ * Here, on the first scan of a frame, the vehicles and peds of the repeat sector lists are binned into a grid (Sorted by cell),
+ * then the nearest `MAX_NUM_ENTITIES` of both are found in one sweep (Optionally in parallel), and the scanners just copy them.
+ * Scanners only scan every `MAX_NUM_ENTITIES` calls (See their timer), so only the lists of the scanners that are due this frame are swept.
+ *
+ * `CEntityScanner::ScanForEntitiesInRange` isn't reversed yet, so the lists may differ from vanilla:
+ * Here they have the entities within `g_WorldConfig.SharedScannerRange`, closest first, without the ped itself.
+ * As that changes the input of the peds' AI, it's only used in debug builds (`NOTSA_DEBUG`) until the function is reversed, and its rule reproduced.
+ * Peds that weren't in the sweep (Created after it) are scanned the vanilla way.
+ *
+ * The sweep only reads the world, the scanners' references are changed on the main thread, when the peds are processed, in the original order.
+ * The peds and entities are kept as pool references, so ones deleted (or whose slot was reused) since the sweep are skipped.
+ * With `SharedScannerVerify` the lists of every sweep are checked against a brute-force search (Testing all entities, not just the ones in the neighbouring cells).
+ *
+ * Only the scanners' lists come from the snapshot: the rest of the peds' intelligence (`CEventScanner`, `CDecisionMaker`, the task trees, etc.)
+ * is still processed serially from `CPed::ProcessControl`, changing the world as it goes - There's no deferred mutation queue
+ * (nor a serial/parallel check of the outcomes), so processing it in parallel isn't possible yet.
+ */
+class NeighbourGrid {
+public:
+    struct Stats {
+        uint32 NumVehicles{};   //!< Number of vehicles binned in the last build
+        uint32 NumPeds{};       //!< Number of peds binned in the last build
+        uint32 NumSwept{};      //!< Number of peds whose lists were found in the last build (The ones with a scanner due)
+        uint64 NumBuilds{};
+        uint64 NumHits{};       //!< Number of scans served by the grid
+        uint64 NumMisses{};     //!< Number of scans that fell back to the vanilla scan
+        uint64 NumVerified{};   //!< Number of sweeps checked against a brute-force search (See `SharedScannerVerify`)
+        uint64 NumMismatches{}; //!< Number of peds whose lists differed from the brute-force search's
+    };
+
+public:
+    //! Build the grid if it wasn't built this frame yet (Called before the entities are processed, so all peds see the same snapshot of the world)
+    void Update();
+
+    //! Get the nearest entities (of the list's type) of a ped this frame (Building the grid on the first call of the frame)
+    //! @return The entities, or `std::nullopt` if the ped (or this list of it) wasn't in the sweep
+    std::optional<std::span<CEntity* const>> GetNearest(const CPed& ped, eRepeatSectorList list);
+
+    //! Forget the lists (They're rebuilt on the next call of `GetNearest` anyways)
+    void Clear();
+
+    const Stats& GetStats() const { return m_Stats; }
+    void         ResetStats();
+
+private:
+    static constexpr size_t NUM_LISTS = 2; //!< Vehicles and peds
+
+    struct Item {
+        uint32   Cell{};
+        CVector  Pos{};
+        CEntity* Entity{};
+        int32    Ref{}; //!< Pool reference of `Entity`
+    };
+
+    struct Result {
+        const CPed*                                                     Ped{};    //!< The ped whose lists these are (If null the slot's ped wasn't in the sweep)
+        int32                                                           PedRef{}; //!< Pool reference of `Ped`
+        std::array<bool, NUM_LISTS>                                     IsDue{};  //!< Whether the list was swept (The ped's scanner of it is due this frame)
+        std::array<std::array<CEntity*, MAX_NUM_ENTITIES>, NUM_LISTS> Nearest{};
+        std::array<std::array<int32, MAX_NUM_ENTITIES>, NUM_LISTS>    NearestRefs{};
+        std::array<uint8, NUM_LISTS>                                    NumNearest{};
+    };
+
+    void   Build();
+    void   Sweep(std::span<Result> results, bool parallel) const;
+    void   Verify();
+    void   FindNearest(const CPed& ped, Result& result) const;
+    uint32 GetCell(int32 x, int32 y) const;
+    int32  GetCellCoord(float x) const;
+
+private:
+    std::array<std::vector<Item>, NUM_LISTS> m_Items{};   //!< Entities of the lists, sorted by cell
+    std::vector<Result>                      m_Results{}; //!< By ped pool index
+    uint32                                   m_Frame{ (uint32)-1 };
+    float                                    m_Range{};
+    Stats                                    m_Stats{};
+};
+}; // namespace notsa
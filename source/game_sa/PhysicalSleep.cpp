@@ -0,0 +1,192 @@
+#include "StdInc.h"
+
+#include "PhysicalSleep.h"
+
+#include "extensions/Configs/World.hpp"
+
+namespace notsa {
+void PhysicalSleep::Update() {
+    ZoneScoped;
+
+    if (!g_WorldConfig.PhysicalSleep) {
+        WakeAll();
+        Clear();
+        return;
+    }
+
+    WakeDisturbed();
+
+    // Update how long the moving entities have been resting for (Entities no longer moving are dropped)
+    std::swap(m_RestingTime, m_PrevRestingTime);
+    m_RestingTime.clear();
+    m_Stats.NumResting = 0;
+    for (auto* const entity : CWorld::ms_listMovingEntityPtrs) {
+        auto time = 0.f;
+        if (IsResting(*entity)) {
+            const auto it = m_PrevRestingTime.find(entity);
+            time          = (it != m_PrevRestingTime.end() ? it->second : 0.f) + CTimer::GetTimeStepInMS();
+            m_Stats.NumResting++;
+        }
+        m_RestingTime[entity] = time;
+    }
+
+    // Put the islands whose entities have all been resting long enough to sleep
+    m_Islands.Build();
+    for (const auto& island : m_Islands.GetIslands()) {
+        const auto entities = m_Islands.GetEntities(island);
+        if (!rng::all_of(entities, [this](CPhysical* e) { return m_RestingTime[e] >= g_WorldConfig.PhysicalSleepTime && CanSleep(*e); })) {
+            continue;
+        }
+        for (auto* const e : entities) {
+            Sleep(*e);
+        }
+    }
+
+    m_Stats.NumAwake    = (uint32)CWorld::ms_listMovingEntityPtrs.GetSize();
+    m_Stats.NumSleeping = (uint32)m_Sleeping.size();
+}
+
+void PhysicalSleep::WakeDisturbed() {
+    std::erase_if(m_Sleeping, [this](const Sleeper& s) {
+        CPhysical* const entity = s.IsVehicle
+            ? static_cast<CPhysical*>(CPools::GetVehicle(s.Ref))
+            : static_cast<CPhysical*>(CPools::GetObject(s.Ref));
+        if (!entity) { // Deleted while sleeping
+            return true;
+        }
+        if (!entity->GetIsStatic()) { // Woken up by the game (Contact, explosion, etc.)
+            entity->AddToMovingList();
+            m_Stats.NumWokenUp++;
+            return true;
+        }
+        if (!entity->GetMoveSpeed().IsZero() || !entity->GetTurnSpeed().IsZero() || !CanSleep(*entity)) {
+            Wake(*entity);
+            return true;
+        }
+        return false;
+    });
+}
+
+void PhysicalSleep::WakeAll() {
+    for (const auto& s : m_Sleeping) {
+        CPhysical* const entity = s.IsVehicle
+            ? static_cast<CPhysical*>(CPools::GetVehicle(s.Ref))
+            : static_cast<CPhysical*>(CPools::GetObject(s.Ref));
+        if (entity && entity->GetIsStatic()) {
+            Wake(*entity);
+        }
+    }
+    m_Sleeping.clear();
+    m_Stats.NumSleeping = 0;
+}
+
+void PhysicalSleep::WakeInSphere(const CVector& point, float radius) {
+    std::erase_if(m_Sleeping, [&, this](const Sleeper& s) {
+        CPhysical* const entity = s.IsVehicle
+            ? static_cast<CPhysical*>(CPools::GetVehicle(s.Ref))
+            : static_cast<CPhysical*>(CPools::GetObject(s.Ref));
+        if (!entity) { // Deleted while sleeping
+            return true;
+        }
+        if ((entity->GetPosition() - point).SquaredMagnitude() >= sq(radius)) { // Same check as `CWorld::TriggerExplosionSectorList`
+            return false;
+        }
+        if (entity->GetIsStatic()) {
+            Wake(*entity);
+        } else { // Woken up by the game already
+            entity->AddToMovingList();
+            m_Stats.NumWokenUp++;
+        }
+        return true;
+    });
+    m_Stats.NumSleeping = (uint32)m_Sleeping.size();
+}
+
+void PhysicalSleep::Clear() {
+    m_Sleeping.clear();
+    m_RestingTime.clear();
+    m_PrevRestingTime.clear();
+    m_Stats.NumSleeping = 0;
+    m_Stats.NumResting  = 0;
+}
+
+bool PhysicalSleep::CanSleep(CPhysical& entity) {
+    if (   entity.m_pAttachedTo
+        || entity.physicalFlags.bAttachedToEntity
+        || entity.physicalFlags.bSubmergedInWater
+        || entity.GetIsStuck()
+        || entity.m_bRemoveFromWorld
+    ) {
+        return false;
+    }
+
+    switch (entity.GetType()) {
+    case ENTITY_TYPE_VEHICLE: {
+        auto* const vehicle = entity.AsVehicle();
+        if (!vehicle->IsAutomobile() && !vehicle->IsBike()) {
+            return false;
+        }
+        switch (vehicle->GetStatus()) {
+        case STATUS_ABANDONED: {
+            if (vehicle->GetHealth() < 250.f) { // Burning, see `CAutomobile::ProcessControl`
+                return false;
+            }
+            break;
+        }
+        case STATUS_WRECKED:
+            break;
+        default:
+            return false;
+        }
+        return !vehicle->m_pDriver
+            && !vehicle->m_nNumPassengers
+            && !vehicle->vehicleFlags.bEngineOn
+            && !vehicle->vehicleFlags.bRestingOnPhysical
+            && !vehicle->m_pTowingVehicle
+            && !vehicle->m_pVehicleBeingTowed
+            && !vehicle->m_nBombOnBoard
+            && vehicle->CanUpdateHornCounter(); // Alarm isn't going off
+    }
+    case ENTITY_TYPE_OBJECT: {
+        auto* const object = entity.AsObject();
+        auto* const mi     = object->GetModelInfo();
+        return !object->m_pControlCodeList
+            && !(mi->GetRwModelType() == rpCLUMP && mi->bHasAnimBlend); // Animated, see `CObject::ProcessControl`
+    }
+    default:
+        return false;
+    }
+}
+
+bool PhysicalSleep::IsResting(const CPhysical& entity) {
+    return entity.GetMoveSpeed().SquaredMagnitude() <= sq(g_WorldConfig.PhysicalSleepMaxSpeed)
+        && entity.GetTurnSpeed().SquaredMagnitude() <= sq(g_WorldConfig.PhysicalSleepMaxTurnSpeed);
+}
+
+void PhysicalSleep::Sleep(CPhysical& entity) {
+    entity.ResetMoveSpeed();
+    entity.ResetTurnSpeed();
+    entity.ResetFrictionMoveSpeed();
+    entity.ResetFrictionTurnSpeed();
+    entity.SetIsStatic(true);
+    entity.RemoveFromMovingList();
+
+    m_Sleeping.push_back({
+        .Ref       = entity.GetIsTypeVehicle() ? CPools::GetVehicleRef(entity.AsVehicle()) : CPools::GetObjectRef(entity.AsObject()),
+        .IsVehicle = entity.GetIsTypeVehicle(),
+    });
+    m_RestingTime.erase(&entity);
+    m_Stats.NumFellAsleep++;
+}
+
+void PhysicalSleep::Wake(CPhysical& entity) {
+    entity.SetIsStatic(false);
+    entity.AddToMovingList();
+    m_Stats.NumWokenUp++;
+}
+
+void PhysicalSleep::ResetStats() {
+    m_Stats.NumFellAsleep = 0;
+    m_Stats.NumWokenUp    = 0;
+}
+}; // namespace notsa
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <unordered_map>
+#include <vector>
+
+#include "CollisionIslands.h"
+
+class CPhysical;
+
+namespace notsa {
+/*!
+ * @brief NOTSA: Puts the moving entities that have been resting for a while to sleep (Makes them static, removing them from the moving list), and wakes them up when disturbed.
+ *
+ * The game only removes an entity from the moving list once it makes itself static (See `CObject::ProcessControl`),
+ * which vehicles never do, and objects only do when they're perfectly still - So abandoned cars that were bumped, dropped boxes, etc.
+ * often stay in the moving list (jittering) for long periods, each processed (5 times over) every frame.
+ *
+ * An entity is resting if its speeds stay below the thresholds of `g_WorldConfig` for `PhysicalSleepTime`.
+ * Entities are put to sleep island-wide (See `CollisionIslands`): only once all entities of an island can sleep, and are resting,
+ * so an entity never sleeps while something near it is still moving.
+ *
+ * Sleeping entities are woken up by:
+ * - Contacts: The game already wakes static entities up (See `CPhysical::ApplyCollision`)
+ * - Explosions: Sleeping entities in range are woken up before the explosion is applied (See `WakeInSphere`), as the game only wakes
+ *   static objects up if the explosion is strong enough to uproot them, while awake ones react to any explosion
+ * - Impulses: Forces applied to a sleeping entity (Its speeds were zeroed when it went to sleep)
+ * - Anything that makes it unable to sleep (A ped entering the vehicle, the engine starting, etc.) (See `CanSleep`)
+ *
+ * Peds never sleep, as they're animated and their tasks are processed in `ProcessControl` (Dead ones included).
+ */
+class PhysicalSleep {
+public:
+    struct Stats {
+        uint32 NumAwake{};      //!< Number of entities in the moving list
+        uint32 NumSleeping{};   //!< Number of entities put to sleep that are still sleeping
+        uint32 NumResting{};    //!< Number of awake entities that are resting
+        uint64 NumFellAsleep{}; //!< Number of times an entity was put to sleep
+        uint64 NumWokenUp{};    //!< Number of times a sleeping entity was woken up
+    };
+
+public:
+    //! Wake up the disturbed entities, and put the ones that have been resting long enough to sleep (Called once a frame, after the collision is processed)
+    void Update();
+
+    //! Wake up all sleeping entities
+    void WakeAll();
+
+    //! Wake up the sleeping entities whose position is within the sphere (See `CWorld::TriggerExplosion`)
+    void WakeInSphere(const CVector& point, float radius);
+
+    //! Forget all entities (Without waking them up - The world is being cleared)
+    void Clear();
+
+    const Stats& GetStats() const { return m_Stats; }
+    void         ResetStats();
+
+private:
+    //! Whether the entity may be put to sleep at all
+    static bool CanSleep(CPhysical& entity);
+
+    //! Whether the entity's speeds are below the thresholds
+    static bool IsResting(const CPhysical& entity);
+
+    void Sleep(CPhysical& entity);
+    void Wake(CPhysical& entity);
+    void WakeDisturbed();
+
+private:
+    struct Sleeper {
+        int32 Ref{};       //!< Pool reference of the entity (It may be deleted while sleeping)
+        bool  IsVehicle{}; //!< Otherwise it's an object
+    };
+
+    std::vector<Sleeper>                        m_Sleeping{};
+    std::unordered_map<const CPhysical*, float> m_RestingTime{}, m_PrevRestingTime{}; //!< [ms] How long the moving entities have been resting for
+    CollisionIslands                            m_Islands{};
+    Stats                                       m_Stats{};
+};
+}; // namespace notsa
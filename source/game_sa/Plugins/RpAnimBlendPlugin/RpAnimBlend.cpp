@@ -1,6 +1,9 @@
 #include "StdInc.h"
 
 #include "RpAnimBlend.h"
+#include "AnimBlendFrameBatch.h"
+
+#include "extensions/Configs/Animation.hpp"
 
 static auto& ClumpOffset = StaticRef<uint32>(0xB5F878);
 
@@ -1729,6 +1732,49 @@ void FrameUpdateCallBackOffscreen(AnimBlendFrameData* fd, void* data) {
     }
 }
 
+/*!
+ * @notsa
+ * @brief Same as `ForAllFrames(FrameUpdateCallBackW<IsCompressed, IsSkinned>)`, but:
+ * - Frames whose bones aren't in `bones` only have their key-frames advanced (See `notsa::AnimLOD`)
+ * - If `batched`, the frames without velocity extraction are batched (See `notsa::AnimBlendFrameBatch`)
+*/
+template<bool IsCompressed, bool IsSkinned>
+void FrameUpdateEx(CAnimBlendClumpData* bd, AnimBlendUpdateData* c, notsa::AnimLOD::Bones bones, bool batched) {
+    using notsa::AnimLOD;
+
+    static notsa::AnimBlendFrameBatch s_Batch{};
+
+    bd->ForAllFramesF([&](AnimBlendFrameData* fd) {
+        const auto IsEvaluated = [&] {
+            switch (bones) {
+            case AnimLOD::Bones::ALL:  return true;
+            case AnimLOD::Bones::MAIN: return AnimLOD::IsMainBone((eBoneTag)(fd->BoneTag));
+            case AnimLOD::Bones::NONE: return false;
+            default:                   NOTSA_UNREACHABLE();
+            }
+        };
+        if ((fd->HasVelocity && gpAnimBlendClump->m_PedPosition) || (IsEvaluated() && !batched)) {
+            FrameUpdateCallBackW<IsCompressed, IsSkinned>(fd, c); // Increments the node array pointers too
+            return;
+        }
+        if (IsEvaluated()) {
+            s_Batch.Gather<IsCompressed>(*fd, c->BlendNodeArrays, 1.f - CalculateTotalBlendOfPartial(c, fd, true));
+        } else {
+            for (auto it = c->BlendNodeArrays; *it; it++) {
+                if ((*it)->IsValid()) {
+                    (*it)->I_UpdateKeyFrames<IsCompressed>();
+                }
+            }
+        }
+        for (auto it = c->BlendNodeArrays; *it; it++) {
+            ++*it;
+        }
+    });
+    if (batched) {
+        s_Batch.Apply(IsSkinned, NeedsRemoveQuatFlips<IsCompressed, IsSkinned, false, false>{});
+    }
+}
+
 // 0x4D1570
 void RpAnimBlendNodeUpdateKeyFrames(AnimBlendUpdateData* c, AnimBlendFrameData* frames, uint32 nFrames) {
     for (auto it = c->BlendNodeArrays; *it; it++) {
@@ -1754,6 +1800,11 @@ void RpAnimBlendNodeUpdateKeyFrames(AnimBlendUpdateData* c, AnimBlendFrameData*
 
 // 0x4D34F0
 void RpAnimBlendClumpUpdateAnimations(RpClump* clump, float timeStep, bool isOnScreen) {
+    RpAnimBlendClumpUpdateAnimationsLOD(clump, timeStep, isOnScreen, notsa::AnimLOD::Bones::ALL);
+}
+
+// NOTSA
+void RpAnimBlendClumpUpdateAnimationsLOD(RpClump* clump, float timeStep, bool isOnScreen, notsa::AnimLOD::Bones bones) {
     const auto bd = RpAnimBlendClumpGetData(clump);
 
     if (bd->m_AnimList.IsEmpty()) {
@@ -1802,23 +1853,39 @@ void RpAnimBlendClumpUpdateAnimations(RpClump* clump, float timeStep, bool isOnS
     rootFD->IsUpdatingFrame = true;
 
     if (rootFD->IsCompressed) {
-        bd->ForAllFrames(
-            IsClumpSkinned(clump)
-                ? &FrameUpdateCallBackW<true, true>   // FrameUpdateCallBackCompressedSkinned
-                : &FrameUpdateCallBackW<true, false>, // FrameUpdateCallBackCompressedNonSkinned
-            &ctx
-        );
+        if (g_AnimationConfig.BatchedFrameUpdate || bones != notsa::AnimLOD::Bones::ALL) { // NOTSA
+            if (IsClumpSkinned(clump)) {
+                FrameUpdateEx<true, true>(bd, &ctx, bones, g_AnimationConfig.BatchedFrameUpdate);
+            } else {
+                FrameUpdateEx<true, false>(bd, &ctx, bones, g_AnimationConfig.BatchedFrameUpdate);
+            }
+        } else {
+            bd->ForAllFrames(
+                IsClumpSkinned(clump)
+                    ? &FrameUpdateCallBackW<true, true>   // FrameUpdateCallBackCompressedSkinned
+                    : &FrameUpdateCallBackW<true, false>, // FrameUpdateCallBackCompressedNonSkinned
+                &ctx
+            );
+        }
     } else if (isOnScreen) {
         if (rootFD->NeedsKeyFrameUpdate) {
             RpAnimBlendNodeUpdateKeyFrames(&ctx, bd->m_FrameDatas, bd->m_NumFrameData);
         }
 
-        bd->ForAllFrames(
-            IsClumpSkinned(clump)
-                ? FrameUpdateCallBackW<false, true>   // FrameUpdateCallBackSkinned
-                : FrameUpdateCallBackW<false, false>, // FrameUpdateCallBackNonSkinned
-            &ctx
-        );
+        if (g_AnimationConfig.BatchedFrameUpdate || bones != notsa::AnimLOD::Bones::ALL) { // NOTSA
+            if (IsClumpSkinned(clump)) {
+                FrameUpdateEx<false, true>(bd, &ctx, bones, g_AnimationConfig.BatchedFrameUpdate);
+            } else {
+                FrameUpdateEx<false, false>(bd, &ctx, bones, g_AnimationConfig.BatchedFrameUpdate);
+            }
+        } else {
+            bd->ForAllFrames(
+                IsClumpSkinned(clump)
+                    ? FrameUpdateCallBackW<false, true>   // FrameUpdateCallBackSkinned
+                    : FrameUpdateCallBackW<false, false>, // FrameUpdateCallBackNonSkinned
+                &ctx
+            );
+        }
 
         rootFD->NeedsKeyFrameUpdate = false;
     } else {
@@ -1,5 +1,7 @@
 #pragma once
 
+#include "AnimLOD.h"
+
 class CAnimBlendClumpData;
 class AnimBlendFrameData;
 class CAnimBlendAssociation;
@@ -272,6 +274,13 @@ void RpAnimBlendClumpSetBlendDeltas(RpClump* clump, uint32 flags, float blendDel
 */
 void RpAnimBlendClumpUpdateAnimations(RpClump* clump, float step, bool onScreen);
 
+/*!
+ * @notsa
+ * @brief Same as `RpAnimBlendClumpUpdateAnimations`, but only the given bones are evaluated if the clump is on screen (See `notsa::AnimLOD`)
+ * @param bones The bones to evaluate (The ones used for velocity extraction are always evaluated)
+*/
+void RpAnimBlendClumpUpdateAnimationsLOD(RpClump* clump, float step, bool onScreen, notsa::AnimLOD::Bones bones);
+
 /*!
  * @addr 0x4D60E0
  * @brief R* hacking
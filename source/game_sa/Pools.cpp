@@ -22,6 +22,8 @@
 #include <Pools/TaskAllocatorPool.h>
 #include <Pools/PedAttractorPool.h>
 
+#include "extensions/Configs/Pools.hpp"
+
 auto& ms_pPedPool               = StaticRef<CPedPool*>(0xB74490);
 auto& ms_pVehiclePool           = StaticRef<CVehiclePool*>(0xB74494);
 auto& ms_pBuildingPool          = StaticRef<CBuildingPool*>(0xB74498);
@@ -86,6 +88,20 @@ void CPools::Initialise() {
     ms_pTaskAllocatorPool     = new CTaskAllocatorPool(16, "TaskAllocator");
     ms_pPedIntelligencePool   = new CPedIntelligencePool(140, "PedIntelligence");
     ms_pPedAttractorPool      = new CPedAttractorPool(64, "PedAttractors");
+
+    // NOTSA
+    // The free-list and the occupancy bitmap are only updated by our `CPool::New/Delete`, so objects allocated/freed by unhooked code
+    // (The exe's inlined `CPool::New`, or an unhooked `operator new/delete`) would be missed by them.
+    // So they're only used for pools whose every allocation/deallocation goes through a locked hook (Same ones that are safe to grow, see `CPool::SetGrowable`)
+    const auto SetUpPool = [](auto* pool, size_t maxCapacity) {
+        pool->SetUseFreeList(g_PoolsConfig.UseFreeList);
+        pool->SetTrackOccupancy(g_PoolsConfig.TrackOccupancy);
+        if (maxCapacity > pool->GetSize()) {
+            pool->SetGrowable(std::max<size_t>(pool->GetSize() / 4, 1), maxCapacity);
+        }
+    };
+    SetUpPool(ms_pEntryInfoNodePool, g_PoolsConfig.MaxEntryInfoNodes); // `CEntryInfoNode::operator new/delete` are locked
+    SetUpPool(ms_pEventPool, g_PoolsConfig.MaxEvents);                 // `CEvent::operator new/delete` are locked
 }
 
 // 0x5519F0
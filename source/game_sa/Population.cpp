@@ -1760,10 +1760,8 @@ void CPopulation::ManagePopulation() {
         const auto poolSize = pool->GetSize();
         const auto startIdx = (poolSize * batch) / framePopulation;
         const auto endIdx   = (poolSize * (batch + 1)) / framePopulation;
-        for (auto i = startIdx; i < endIdx; ++i) {
-            if (auto* obj = pool->GetAt(i)) {
-                ManageObject(obj, centre);
-            }
+        for (auto i = pool->FindNextUsedSlot((int32)(startIdx)); i < (int32)(endIdx); i = pool->FindNextUsedSlot(i + 1)) {
+            ManageObject(pool->GetAt(i), centre);
         }
     }
     
@@ -1773,10 +1771,8 @@ void CPopulation::ManagePopulation() {
         const auto poolSize = pool->GetSize();
         const auto startIdx = (poolSize * batch) / framePopulation;
         const auto endIdx   = (poolSize * (batch + 1)) / framePopulation;
-        for (auto i = startIdx; i < endIdx; ++i) {
-            if (auto* dummy = pool->GetAt(i)) {
-                ManageDummy(dummy, centre);
-            }
+        for (auto i = pool->FindNextUsedSlot((int32)(startIdx)); i < (int32)(endIdx); i = pool->FindNextUsedSlot(i + 1)) {
+            ManageDummy(pool->GetAt(i), centre);
         }
     }
     
@@ -910,8 +910,10 @@ void CRenderer::ScanPtrList_RequestModels(PtrListType& list) {
     for (auto* const entity : list) {
         if (!entity->IsScanCodeCurrent()) {
             entity->SetCurrentScanCode() ;
-            if (ShouldModelBeStreamed(entity, ms_vecCameraPosition, ms_fFarClipPlane))
+            if (ShouldModelBeStreamed(entity, ms_vecCameraPosition, ms_fFarClipPlane)) {
                 CStreaming::RequestModel(entity->m_nModelIndex, gnRendererModelRequestFlags);
+                CStreaming::ms_Evictor.OnUsedAt(entity->m_nModelIndex, entity->GetPosition()); // NOTSA
+            }
         }
     }
 }
@@ -21,6 +21,9 @@ static notsa::log_ptr logger;
 #include "CommandParser/Parser.hpp"
 #include "CommandParser/LUTGenerator.hpp"
 #include "reversiblehooks/ReversibleHook/ScriptCommand.h"
+#include "ScriptProfiler.h"
+#include "ScriptDecodeCache.h"
+#include "extensions/Configs/Scripts.hpp"
 
 #include "Commands/Commands.hpp"
 #ifdef NOTSA_WITH_CLEO_SCRIPT_COMMANDS // TODO: Add premake/cmake option for this define
@@ -882,6 +885,10 @@ void CRunningScript::UpdatePC(int32 newIP) {
 OpcodeResult CRunningScript::ProcessOneCommand() {
     ++CTheScripts::CommandsExecuted;
 
+    const auto* const decoded = g_ScriptsConfig.DecodeCache // NOTSA
+        ? notsa::script::DecodeCache::Get(m_IP)
+        : nullptr;
+
     const auto op = GetAtIPAs<scm::Instruction>();
 
     // Check if IP is valid pre-return
@@ -900,6 +907,15 @@ OpcodeResult CRunningScript::ProcessOneCommand() {
     
     m_NotFlag = op.NotFlag;
 
+#ifdef NOTSA_WITH_SCRIPT_PROFILER
+    notsa::script::Profiler::CommandScope profile{ (eScriptCommands)(op.Command) };
+#endif
+
+    if (decoded) { // NOTSA
+        return decoded->Custom
+            ? std::invoke(decoded->Custom, this)
+            : std::invoke(decoded->Original, this, (eScriptCommands)(op.Command));
+    }
     if (const auto handler = CustomCommandHandlerOf((eScriptCommands)(op.Command))) {
         return std::invoke(handler, this);
     } else {
@@ -928,6 +944,9 @@ OpcodeResult CRunningScript::Process() {
     CTheScripts::ReinitialiseSwitchStatementData();
 
     if (CTimer::GetTimeInMS() >= (uint32)m_WakeTime) {
+#ifdef NOTSA_WITH_SCRIPT_PROFILER
+        notsa::script::Profiler::ScriptScope profile{ m_szName };
+#endif
         while (ProcessOneCommand() == OR_CONTINUE)
             ; // Process commands
     }
@@ -935,6 +954,16 @@ OpcodeResult CRunningScript::Process() {
     return OR_CONTINUE;
 }
 
+// NOTSA: Whether `Process` would do anything this frame - Most scripts are sleeping in a `WAIT`, with nothing else to check.
+//        A priority queue (by `m_WakeTime`) wouldn't help, the list is walked either way (The timers of all scripts have to be updated every frame),
+//        and scripts have to run in list order - So sleeping scripts are just skipped in the walk.
+bool CRunningScript::IsProcessingNeeded() const {
+    return m_SceneSkipIP
+        || m_UsesMissionCleanup && m_IsDeathArrestCheckEnabled
+        || m_ThisMustBeTheOnlyMissionRunning && CTheScripts::FailCurrentMission == 1
+        || CTimer::GetTimeInMS() >= (uint32)m_WakeTime;
+}
+
 void CRunningScript::HighlightImportantArea(CVector2D from, CVector2D to, float z) {
     CTheScripts::HighlightImportantArea(reinterpret_cast<int32>(this) + reinterpret_cast<int32>(m_IP), from.x, from.y, to.x, to.y, z);
 }
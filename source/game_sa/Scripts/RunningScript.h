@@ -319,6 +319,7 @@ public:
 
     OpcodeResult ProcessOneCommand();
     OpcodeResult Process();
+    bool         IsProcessingNeeded() const; // NOTSA
 
     void SetName(const char* name)      { strcpy_s(m_szName, name); }
     void SetName(std::string_view name) { assert(name.size() < sizeof(m_szName)); strncpy_s(m_szName, name.data(), name.size()); }
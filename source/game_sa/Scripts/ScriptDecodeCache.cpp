@@ -0,0 +1,42 @@
+#include "StdInc.h"
+
+#include "ScriptDecodeCache.h"
+#include "TheScripts.h"
+
+namespace notsa {
+namespace script {
+auto DecodeCache::Get(const uint8* ip) -> const Handlers* {
+    const auto offset = (uintptr_t)(ip) - (uintptr_t)(CTheScripts::ScriptSpace.data()); // Wraps around if `ip` is below the script space
+    if (offset + sizeof(scm::Instruction) > CTheScripts::ScriptSpace.size()) {
+        return nullptr;
+    }
+    if (s_Entries.empty()) {
+        s_Entries.resize(CTheScripts::ScriptSpace.size());
+    }
+
+    uint16 instruction;
+    std::memcpy(&instruction, ip, sizeof(instruction));
+
+    auto& e = s_Entries[offset];
+    if (e.Generation == s_Generation && e.Instruction == instruction) {
+        s_Stats.NumHits++;
+        return &e;
+    }
+    s_Stats.NumMisses++;
+
+    const auto command = (eScriptCommands)(std::bit_cast<scm::Instruction>(instruction).Command);
+    e.Custom           = CRunningScript::CustomCommandHandlerOf(command);
+    e.Original         = CRunningScript::s_OriginalCommandHandlerTable[(size_t)(command) / 100];
+    e.Instruction      = instruction;
+    e.Generation       = s_Generation;
+    return &e;
+}
+
+void DecodeCache::Invalidate() {
+    if (++s_Generation == 0) { // Wrapped around, entries of the first generation could be taken as valid
+        rng::fill(s_Entries, Entry{});
+        s_Generation = 1;
+    }
+}
+}; // namespace script
+}; // namespace notsa
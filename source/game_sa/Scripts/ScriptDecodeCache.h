@@ -0,0 +1,56 @@
+#pragma once
+
+#include <vector>
+
+#include "RunningScript.h"
+
+namespace notsa {
+namespace script {
+/*!
+ * @brief NOTSA: Handlers of the instructions in the script space (The main SCM and the mission block), resolved once per instruction.
+ *
+ * `CRunningScript::ProcessOneCommand` looks up the handler of every instruction it executes (The reversed one, or the original one of its group).
+ * Here the handlers are cached by the instruction's offset in the script space, so scripts looping over the same instructions resolve them only once.
+ * Scripts streamed by `CStreamedScripts` aren't in the script space, so their handlers are looked up the vanilla way.
+ *
+ * The script space is written by more than just hooked code (Mission loading, globals, etc.), so instead of tracking the writes,
+ * each entry keeps the instruction it was decoded from, and is decoded again if the instruction there is different.
+ * The handlers may also change (A script command hook being toggled), see `Invalidate`.
+ *
+ * The operands are still decoded by the handlers themselves, straight from the IP (`notsa::script::Read` or `CollectParameters`).
+ */
+class DecodeCache {
+public:
+    struct Stats {
+        uint64 NumHits{};   //!< Number of instructions whose handlers were cached
+        uint64 NumMisses{}; //!< Number of instructions decoded
+    };
+
+    struct Handlers {
+        CommandHandlerFunction             Custom{};   //!< Reversed handler (See `CRunningScript::CustomCommandHandlerOf`) - If null, `Original` is used
+        CRunningScript::CommandHandlerFn_t Original{}; //!< Handler of the command's group (See `CRunningScript::s_OriginalCommandHandlerTable`)
+    };
+
+public:
+    //! Get the handlers of the instruction at `ip` (Decoding it if needed)
+    //! @return The handlers, or null if `ip` isn't in the script space
+    static const Handlers* Get(const uint8* ip);
+
+    //! Forget all decoded instructions (The handlers changed)
+    static void Invalidate();
+
+    static const Stats& GetStats() { return s_Stats; }
+    static void         ResetStats() { s_Stats = {}; }
+
+private:
+    struct Entry : Handlers {
+        uint16 Instruction{}; //!< The instruction it was decoded from (Command and not flag)
+        uint16 Generation{};  //!< `s_Generation` at the time it was decoded (`0` if never decoded)
+    };
+
+    static inline std::vector<Entry> s_Entries{}; //!< By offset in the script space (Allocated on first use)
+    static inline uint16             s_Generation{ 1 };
+    static inline Stats              s_Stats{};
+};
+}; // namespace script
+}; // namespace notsa
@@ -0,0 +1,70 @@
+#include "StdInc.h"
+
+#include <fstream>
+
+#include "ScriptProfiler.h"
+
+namespace notsa {
+namespace script {
+Profiler::ScriptScope::ScriptScope(const char* name) {
+    if (!s_Enabled) {
+        return;
+    }
+    m_Entry      = FindOrAddScript(name);
+    m_StartCalls = s_TotalCalls;
+    m_Start      = ReadCycles();
+}
+
+Profiler::ScriptScope::~ScriptScope() {
+    if (!m_Entry) {
+        return;
+    }
+    const auto cycles = ReadCycles() - m_Start;
+    m_Entry->Cycles += cycles;
+    m_Entry->Calls += s_TotalCalls - m_StartCalls;
+    m_Entry->NumProcessed++;
+    s_TotalCycles += cycles;
+}
+
+void Profiler::Reset() {
+    s_Commands.fill({});
+    s_Scripts.fill({});
+    s_NumScripts  = 0;
+    s_TotalCycles = 0;
+    s_TotalCalls  = 0;
+}
+
+bool Profiler::DumpCSV(const std::filesystem::path& path) {
+    std::ofstream of{ path };
+    if (!of) {
+        NOTSA_LOG_WARN("Couldn't open {} for writing", path.string());
+        return false;
+    }
+
+    of << "Type,Id,Name,Calls,Cycles,CyclesPerCall\n";
+    for (auto&& [id, e] : rngv::enumerate(s_Commands)) {
+        if (!e.Calls) {
+            continue;
+        }
+        of << "Command," << id << ',' << GetScriptCommandName((eScriptCommands)id) << ',' << e.Calls << ',' << e.Cycles << ',' << e.Cycles / e.Calls << '\n';
+    }
+    for (auto&& [id, e] : rngv::enumerate(GetScripts())) {
+        of << "Script," << id << ',' << std::string_view{ e.Name, strnlen(e.Name, std::size(e.Name)) } << ',' << e.Calls << ',' << e.Cycles << ',' << (e.Calls ? e.Cycles / e.Calls : 0) << '\n';
+    }
+    return true;
+}
+
+auto Profiler::FindOrAddScript(const char* name) -> ScriptEntry* {
+    const auto scripts = std::span{ s_Scripts }.first(s_NumScripts);
+    if (const auto it = rng::find_if(scripts, [name](const ScriptEntry& e) { return !strncmp(e.Name, name, std::size(e.Name) - 1); }); it != scripts.end()) {
+        return &*it;
+    }
+    if (s_NumScripts >= MAX_SCRIPTS) {
+        return nullptr;
+    }
+    auto& e = s_Scripts[s_NumScripts++];
+    strncpy_s(e.Name, name, std::size(e.Name) - 1);
+    return &e;
+}
+}; // namespace script
+}; // namespace notsa
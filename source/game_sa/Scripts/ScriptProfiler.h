@@ -0,0 +1,95 @@
+#pragma once
+
+#include <array>
+#include <filesystem>
+#include <span>
+#include <intrin.h>
+
+#include "eScriptCommands.h"
+
+namespace notsa {
+namespace script {
+/*!
+ * @brief NOTSA: Counts the commands executed (And the CPU cycles spent in them) per command and per script.
+ *
+ * Compiled in if `NOTSA_WITH_SCRIPT_PROFILER` is defined (CMake option `GTASA_WITH_SCRIPT_PROFILER`), and only counts while enabled (See `ScriptDebugModule`).
+ * The cycles are read with `rdtsc`, which costs a few dozen cycles per command - A lot less than even the simplest commands.
+ * The totals are kept in fixed tables, so there are no allocations while profiling.
+ */
+class Profiler {
+public:
+    static constexpr size_t MAX_SCRIPTS = 256; //!< Scripts (by name) after this many aren't profiled
+
+    struct Entry {
+        uint64 Calls{};
+        uint64 Cycles{};
+    };
+
+    struct ScriptEntry : Entry {
+        char   Name[8]{};      //!< Name of the script (`CRunningScript::m_szName`)
+        uint64 NumProcessed{}; //!< Number of `CRunningScript::Process` calls
+    };
+
+    //! Profiles a command (For the duration of the scope)
+    class CommandScope {
+    public:
+        CommandScope(eScriptCommands command) :
+            m_Command{ command },
+            m_Start{ s_Enabled ? ReadCycles() : 0 }
+        {
+        }
+
+        ~CommandScope() {
+            if (m_Start) {
+                auto& e = s_Commands[(size_t)m_Command];
+                e.Calls++;
+                e.Cycles += ReadCycles() - m_Start;
+                s_TotalCalls++;
+            }
+        }
+
+    private:
+        eScriptCommands m_Command;
+        uint64          m_Start;
+    };
+
+    //! Profiles a script's `Process` call (For the duration of the scope)
+    class ScriptScope {
+    public:
+        ScriptScope(const char* name);
+        ~ScriptScope();
+
+    private:
+        ScriptEntry* m_Entry{};
+        uint64       m_Start{};
+        uint64       m_StartCalls{}; //!< Total number of commands executed at the start
+    };
+
+public:
+    static bool IsEnabled() { return s_Enabled; }
+    static void SetEnabled(bool enabled) { s_Enabled = enabled; }
+
+    static void Reset();
+
+    //! Write both tables to a CSV file
+    static bool DumpCSV(const std::filesystem::path& path);
+
+    static const Entry& GetCommand(eScriptCommands command) { return s_Commands[(size_t)command]; }
+    static auto         GetScripts() { return std::span{ s_Scripts }.first(s_NumScripts); }
+    static uint64       GetTotalCycles() { return s_TotalCycles; }
+    static uint64       GetTotalCalls() { return s_TotalCalls; }
+
+private:
+    static uint64       ReadCycles() { return __rdtsc(); }
+    static ScriptEntry* FindOrAddScript(const char* name);
+
+private:
+    static inline bool                                                        s_Enabled{};
+    static inline std::array<Entry, (size_t)(COMMAND_HIGHEST_ID_TO_HOOK) + 1> s_Commands{};
+    static inline std::array<ScriptEntry, MAX_SCRIPTS>                        s_Scripts{};
+    static inline size_t                                                      s_NumScripts{};
+    static inline uint64                                                      s_TotalCycles{}; //!< Cycles spent in `CRunningScript::Process` (Of all scripts)
+    static inline uint64                                                      s_TotalCalls{};  //!< Commands executed
+};
+}; // namespace script
+}; // namespace notsa
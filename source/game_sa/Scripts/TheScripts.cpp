@@ -1434,6 +1434,9 @@ void CTheScripts::Process() {
 
         it->m_LocalVars[SCRIPT_VAR_TIMERA].iParam += timeStepMS;
         it->m_LocalVars[SCRIPT_VAR_TIMERB].iParam += timeStepMS;
+        if (!it->IsProcessingNeeded()) { // NOTSA: Skip sleeping scripts
+            continue;
+        }
         it->Process();
     }
 
@@ -7,11 +7,47 @@
 #include "TheScripts.h"
 #include "LoadingScreen.h"
 #include "VehicleRecording.h"
+#include "CdStreamAsyncReader.h"
+#include "CdDirectoryIndex.h"
+
+#include "extensions/Configs/Streaming.hpp"
 
 static auto& CurrentGangMemberToLoad = StaticRef<int32>(0x9654D4);
 
 auto& gRwStream = StaticRef<RwStream>(0x8E48AC);
 
+namespace {
+// NOTSA: Name key => ID tables for `LoadCdDirectory`, so it doesn't have to do a linear search for every entry.
+//        Only exist while `LoadCdDirectory()` runs, otherwise the vanilla lookups are used.
+std::optional<notsa::KeyHashTable> s_ModelIdsByKey{};
+std::optional<notsa::KeyHashTable> s_TxdSlotsByKey{};
+
+int32 FindModelIdByName(const char* name) {
+    if (!s_ModelIdsByKey) {
+        int32 modelId = MODEL_INVALID;
+        return CModelInfo::GetModelInfo(name, &modelId) ? modelId : MODEL_INVALID;
+    }
+    const auto modelId = s_ModelIdsByKey->Find(CKeyGen::GetUppercaseKey(name));
+    return modelId != notsa::KeyHashTable::EMPTY ? (int32)modelId : MODEL_INVALID;
+}
+
+int32 FindTxdSlotByName(const char* name) {
+    if (!s_TxdSlotsByKey) {
+        return CTxdStore::FindTxdSlot(name);
+    }
+    const auto slot = s_TxdSlotsByKey->Find(CKeyGen::GetUppercaseKey(name));
+    return slot != notsa::KeyHashTable::EMPTY ? (int32)slot : -1;
+}
+
+int32 AddTxdSlotByName(const char* name) {
+    const auto slot = CTxdStore::AddTxdSlot(name);
+    if (s_TxdSlotsByKey) {
+        s_TxdSlotsByKey->InsertUnique(CKeyGen::GetUppercaseKey(name), (uint32)slot);
+    }
+    return slot;
+}
+};
+
 void CStreaming::InjectHooks() {
     RH_ScopedClass(CStreaming);
     RH_ScopedCategoryGlobal();
@@ -332,6 +368,13 @@ int32 CStreaming::GetNextFileOnCd(uint32 streamLastPosn, bool bNotPriority) {
     uint32 firstRequestModelOffset = UINT32_MAX;
     int32  firstRequestModelId    = MODEL_INVALID;
     int32  nextRequestModelId     = MODEL_INVALID;
+
+    // NOTSA: Let the scheduler pick among the models that can be read
+    const auto useScheduler = g_StreamingConfig.Scheduler;
+    if (useScheduler) {
+        ms_Scheduler.BeginPick(streamLastPosn);
+    }
+
     for (auto info = ms_pStartRequestedList->GetNext(); info != ms_pEndRequestedList; info = info->GetNext()) {
         const auto modelId = GetModelFromInfo(info);
         if (bNotPriority && ms_numPriorityRequests != 0 && !info->IsPriorityRequest())
@@ -346,6 +389,7 @@ int32 CStreaming::GetNextFileOnCd(uint32 streamLastPosn, bool bNotPriority) {
             const auto txdModel = TXDToModelId(modelInfo->m_nTxdIndex);
             if (!GetInfo(txdModel).IsLoadedOrBeingRead()) {
                 RequestModel(txdModel, GetInfo(modelId).GetFlags()); // Request TXD for this DFF
+                ms_Scheduler.OnDependencyRequested(txdModel, modelId); // NOTSA
                 continue;
             }
 
@@ -355,6 +399,7 @@ int32 CStreaming::GetNextFileOnCd(uint32 streamLastPosn, bool bNotPriority) {
                 const int32 animModelId = IFPToModelId(animFileIndex);
                 if (!GetInfo(animModelId).IsLoadedOrBeingRead()) {
                     RequestModel(animModelId, STREAMING_KEEP_IN_MEMORY);
+                    ms_Scheduler.OnDependencyRequested(animModelId, modelId); // NOTSA
                     continue;
                 }
             }
@@ -368,6 +413,7 @@ int32 CStreaming::GetNextFileOnCd(uint32 streamLastPosn, bool bNotPriority) {
                 const int32 parentModelIdx = TXDToModelId(parentIndex);
                 if (!GetInfo(parentModelIdx).IsLoadedOrBeingRead()) {
                     RequestModel(parentModelIdx, STREAMING_KEEP_IN_MEMORY);
+                    ms_Scheduler.OnDependencyRequested(parentModelIdx, modelId); // NOTSA
                     continue;
                 }
             }
@@ -395,11 +441,18 @@ int32 CStreaming::GetNextFileOnCd(uint32 streamLastPosn, bool bNotPriority) {
             nextRequestModelOffset = offset;
             nextRequestModelId     = modelId;
         }
+
+        if (useScheduler) {
+            ms_Scheduler.AddCandidate(modelId, offset); // NOTSA
+        }
     }
 
-    const int32 nextModelId = nextRequestModelId == MODEL_INVALID
+    int32 nextModelId = nextRequestModelId == MODEL_INVALID
         ? firstRequestModelId
         : nextRequestModelId;
+    if (useScheduler) {
+        nextModelId = ms_Scheduler.EndPick(nextModelId); // NOTSA
+    }
     if (nextModelId != MODEL_INVALID || ms_numPriorityRequests == 0) {
         return nextModelId;
     }
@@ -432,6 +485,13 @@ bool CStreaming::ConvertBufferToObject(uint8* fileBuffer, int32 modelId) {
     const auto bufferSize = streamingInfo.GetCdSize() * STREAMING_SECTOR_SIZE;
     tRwStreamInitializeData rwStreamInitData = { fileBuffer, bufferSize };
 
+    // NOTSA: Throughput stats
+    const notsa::ScopeGuard recordDecodeStats{ [modelId, bufferSize, begin = std::chrono::steady_clock::now()] {
+        const auto elapsed = std::chrono::steady_clock::now() - begin;
+        ms_DecodeStats[(size_t)GetModelType(modelId)].Add(bufferSize, elapsed);
+        ms_Evictor.OnLoaded(modelId, std::chrono::duration<float, std::milli>(elapsed).count());
+    } };
+
     // Make RW stream from memory
     // TODO: The _ prefix seems to indicate its "private" (maybe), perhaps it was some kind of macro originally?
     // TODO/BUGFIX: Stream seemingly never closed? (But initialized multiple times)
@@ -656,6 +716,7 @@ bool CStreaming::ConvertBufferToObject(uint8* fileBuffer, int32 modelId) {
     if (!streamingInfo.IsLoadingFinishing()) {
         streamingInfo.m_LoadState = LOADSTATE_LOADED;
         ms_memoryUsedBytes += bufferSize;
+        ms_Scheduler.OnLoaded(modelId); // NOTSA
     }
     return true;
 }
@@ -1038,6 +1099,11 @@ void CStreaming::LoadAllRequestedModels(bool bOnlyPriorityRequests) {
 
     FlushChannels();
 
+    // NOTSA: Load as much as possible with many reads in flight, the loop below takes care of the rest
+    if (g_StreamingConfig.AsyncReader) {
+        LoadRequestedModelsAsync(bOnlyPriorityRequests);
+    }
+
     auto numModelsToLoad = std::max(10, 2 * ms_numModelsRequested);
     int32 chIdx = 0;
     while (true) {
@@ -1092,6 +1158,190 @@ void CStreaming::LoadAllRequestedModels(bool bOnlyPriorityRequests) {
     m_bLoadingAllRequestedModels = false;
 }
 
+// NOTSA
+notsa::CdStreamAsyncReader& CStreaming::GetAsyncReader() {
+    static notsa::CdStreamAsyncReader s_Reader{
+        g_StreamingConfig.AsyncReaderThreads,
+        g_StreamingConfig.AsyncReaderMaxReadKiB * 1024 / STREAMING_SECTOR_SIZE
+    };
+    return s_Reader;
+}
+
+// NOTSA
+void CStreaming::LoadRequestedModelsAsync(bool bOnlyPriorityRequests) {
+    ZoneScoped;
+
+    auto& reader = GetAsyncReader();
+    const auto maxBatchSectors = g_StreamingConfig.AsyncReaderMaxBatchKiB * 1024 / STREAMING_SECTOR_SIZE;
+
+    // Same checks as in `RequestModelStream`, except for the ones
+    // that are there to make the models fit into a channel's buffer.
+    const auto CanBeReadNow = [](int32 modelId) {
+        if (IsModelDFF(modelId)) {
+            const auto* const mi = CModelInfo::GetModelInfo(modelId);
+            if (!GetInfo(TXDToModelId(mi->m_nTxdIndex)).IsLoadedOrBeingRead()) {
+                return false;
+            }
+            const auto animFileIndex = mi->GetAnimFileIndex();
+            return animFileIndex == -1 || GetInfo(IFPToModelId(animFileIndex)).IsLoadedOrBeingRead();
+        }
+        if (IsModelIFP(modelId)) {
+            return !CCutsceneMgr::IsCutsceneProcessing() && GetInfo(MODEL_MALE01).IsLoaded();
+        }
+        return true;
+    };
+
+    // DFFs whose TXD/IFP is read in the same batch must wait until those have been loaded
+    const auto AreDependenciesLoaded = [](int32 modelId) {
+        if (!IsModelDFF(modelId)) {
+            return true;
+        }
+        const auto* const mi = CModelInfo::GetModelInfo(modelId);
+        if (!GetInfo(TXDToModelId(mi->m_nTxdIndex)).IsLoaded()) {
+            return false;
+        }
+        const auto animFileIndex = mi->GetAnimFileIndex();
+        return animFileIndex == -1 || GetInfo(IFPToModelId(animFileIndex)).IsLoaded();
+    };
+
+    // COL's can be decoded on the reader threads, except when loaded for the first time (See `CColStore::LoadCol`)
+    const auto CanBeDecodedOffThread = [](int32 modelId) {
+        if (!IsModelCOL(modelId)) {
+            return false;
+        }
+        const auto* const def = CColStore::GetInSlot(ModelIdToCOL(modelId));
+        return def->m_nModelIdStart <= def->m_nModelIdEnd;
+    };
+
+    struct BatchEntry {
+        int32                        ModelId;
+        CdStreamPos                  Pos;
+        uint32                       NumSectors;
+        uint32                       BufferOffset; //!< In sectors
+        CFileLoader::DecodedColFile* DecodedCol;   //!< If decoded off the main thread
+    };
+    std::vector<BatchEntry>                         batch{};
+    std::vector<notsa::CdStreamAsyncReader::Request> requests{};
+    std::vector<size_t>                             deferred{};
+    std::deque<CFileLoader::DecodedColFile>          decodedCols{}; // Deque, so pointers to the elements stay valid
+
+    // Every round loads the models whose dependencies were loaded by the previous one
+    while (!IsRequestListEmpty()) {
+        if (bOnlyPriorityRequests && ms_numPriorityRequests == 0) {
+            break;
+        }
+
+        // Gather the models to read
+        batch.clear();
+        uint32 batchSectors = 0;
+        for (auto *info = ms_pStartRequestedList->GetNext(), *next = info; info != ms_pEndRequestedList; info = next) {
+            next = info->GetNext(); // `info` might be removed from the list
+
+            const auto modelId = (int32)GetModelFromInfo(info);
+
+            if (ms_numPriorityRequests && !info->IsPriorityRequest()) {
+                continue; // There are priority requests, but this isn't one of them
+            }
+
+            // Remove TXD/IFP's that aren't used anymore
+            if (!info->IsRequiredToBeKept()) {
+                if (   IsModelTXD(modelId) && !AreTexturesUsedByRequestedModels(ModelIdToTXD(modelId))
+                    || IsModelIFP(modelId) && !AreAnimsUsedByRequestedModels(ModelIdToIFP(modelId))
+                ) {
+                    RemoveModel(modelId);
+                    continue;
+                }
+            }
+
+            if (!CanBeReadNow(modelId)) {
+                continue;
+            }
+
+            CdStreamPos pos;
+            size_t      numSectors;
+            info->GetCdPosnAndSize(pos, numSectors);
+            if (!batch.empty() && batchSectors + numSectors > maxBatchSectors) {
+                break; // Doesn't fit, next round
+            }
+
+            batch.emplace_back(BatchEntry{ .ModelId = modelId, .Pos = pos, .NumSectors = (uint32)numSectors });
+            batchSectors += numSectors;
+
+            info->m_LoadState = LOADSTATE_READING;
+            info->RemoveFromList();
+            ms_numModelsRequested--;
+            if (info->IsPriorityRequest()) {
+                info->ClearFlags(STREAMING_PRIORITY_REQUEST);
+                ms_numPriorityRequests--;
+            }
+        }
+        if (batch.empty()) {
+            break;
+        }
+        m_bModelStreamNotLoaded = false;
+
+        // Lay the models out in the buffer in the same order as they're on disk, so the reader can coalesce their reads
+        rng::sort(batch, {}, [](const BatchEntry& e) { return e.Pos.ToInt(); });
+        auto* const buffer = (uint8*)CMemoryMgr::MallocAlign(batchSectors * STREAMING_SECTOR_SIZE, STREAMING_SECTOR_SIZE);
+        requests.clear();
+        for (uint32 i = 0, offset = 0; i < batch.size(); offset += batch[i++].NumSectors) {
+            auto& e = batch[i];
+            e.BufferOffset = offset;
+            e.DecodedCol   = CanBeDecodedOffThread(e.ModelId) ? &decodedCols.emplace_back() : nullptr;
+
+            auto* const data = &buffer[offset * STREAMING_SECTOR_SIZE];
+            requests.emplace_back(notsa::CdStreamAsyncReader::Request{
+                .Pos        = e.Pos,
+                .NumSectors = e.NumSectors,
+                .Buffer     = data,
+                .UserData   = i,
+                .OnRead     = e.DecodedCol
+                    ? std::function{ [data, size = e.NumSectors * STREAMING_SECTOR_SIZE, out = e.DecodedCol] {
+                        const auto begin = std::chrono::steady_clock::now();
+                        CFileLoader::DecodeCollisionFile(data, size, *out);
+                        ms_ColDecodeStatsOffThread.Add(size, std::chrono::steady_clock::now() - begin);
+                    } }
+                    : std::function<void()>{},
+            });
+        }
+        reader.Submit(requests);
+
+        // Load the models as their data arrives
+        bool anyReadFailed = false;
+        deferred.clear();
+        for (size_t n = 0; n < batch.size(); n++) {
+            const auto c = reader.WaitCompletion();
+            const auto& e = batch[c.UserData];
+            if (!c.Success) {
+                RemoveModel(e.ModelId);
+                RequestModel(e.ModelId, GetInfo(e.ModelId).GetFlags());
+                anyReadFailed = true;
+                continue;
+            }
+            if (!AreDependenciesLoaded(e.ModelId)) {
+                deferred.push_back(c.UserData);
+                continue;
+            }
+            if (e.DecodedCol) {
+                ConvertDecodedColToObject(*e.DecodedCol, e.ModelId);
+            } else {
+                LoadModelFromBuffer(&buffer[e.BufferOffset * STREAMING_SECTOR_SIZE], e.ModelId);
+            }
+        }
+        for (const auto i : deferred) {
+            const auto& e = batch[i];
+            LoadModelFromBuffer(&buffer[e.BufferOffset * STREAMING_SECTOR_SIZE], e.ModelId); // Re-requests the model if the dependencies still aren't loaded
+        }
+
+        decodedCols.clear(); // Frees the models that weren't linked
+        CMemoryMgr::FreeAlign(buffer);
+
+        if (anyReadFailed) {
+            break; // Let the channels retry (They have proper error handling)
+        }
+    }
+}
+
 // 0x5B6170
 // Load a directory (aka img file)
 // This will set the `CdSize, CdPosn, m_ImgID, m_NextIndexOnCd` member variables of
@@ -1100,23 +1350,13 @@ void CStreaming::LoadCdDirectory(const char* filename, StreamingImgID img) {
     ZoneScoped;
     ZoneText(filename, strlen(filename));
 
-    auto* imgFile = CFileMgr::OpenFile(filename, "rb");
-    if (!imgFile)
+    // NOTSA: Read the whole directory at once, instead of entry-by-entry
+    notsa::CdDirectoryIndex index{};
+    if (!index.Open(filename))
         return;
 
-    // Read and check IMG file version
-    {
-        char version[4];
-        CFileMgr::Read(imgFile, &version, 4u);    // �VER2� for SA
-        assert((std::string_view{version, 4u} == "VER2")); // NOTSA
-    }
-
     int32 previousModelId = MODEL_INVALID;
-    int32 entryCount;
-    CFileMgr::Read(imgFile, &entryCount, sizeof(int32));
-    for (int32 i = 0; i < entryCount; i++) {
-        CDirectory::DirectoryInfo entry{};
-        CFileMgr::Read(imgFile, &entry, sizeof(CDirectory::DirectoryInfo));
+    for (auto entry : index.GetEntries()) { // Copy, as it's modified below
 
         // Maybe increase buffer size
         ms_streamingBufferSize = std::max(ms_streamingBufferSize, (uint32)entry.Size);
@@ -1146,15 +1386,15 @@ void CStreaming::LoadCdDirectory(const char* filename, StreamingImgID img) {
 
         int32 modelId = MODEL_INVALID;
         if (ExtensionIs("DFF")) { // 0x5B6230
-            if (!CModelInfo::GetModelInfo(entry.Name, &modelId)) {
+            if ((modelId = FindModelIdByName(entry.Name)) == MODEL_INVALID) { // NOTSA: Hash lookup instead of `CModelInfo::GetModelInfo`
                 ms_pExtraObjectsDir->AddItem(entry, img); // FIX_BUGS: remember which cdimage this came from
                 previousModelId = MODEL_INVALID;
                 continue;
             }
         } else if (ExtensionIs("TXD")) {
-            int32 txdSlot = CTxdStore::FindTxdSlot(entry.Name);
+            int32 txdSlot = FindTxdSlotByName(entry.Name); // NOTSA: Hash lookup instead of `CTxdStore::FindTxdSlot`
             if (txdSlot == -1) {
-                txdSlot = CTxdStore::AddTxdSlot(entry.Name);
+                txdSlot = AddTxdSlotByName(entry.Name);
                 CVehicleModelInfo::AssignRemapTxd(entry.Name, txdSlot);
             }
             modelId = TXDToModelId(txdSlot);
@@ -1201,7 +1441,6 @@ void CStreaming::LoadCdDirectory(const char* filename, StreamingImgID img) {
             previousModelId = modelId;
         }
     }
-    CFileMgr::CloseFile(imgFile);
 }
 
 // 0x5B82C0
@@ -1217,6 +1456,18 @@ void CStreaming::LoadCdDirectory()
     // ms_imageSize = GetGTA3ImgSize(); 0x406360
     ///////////////////////////////////
 
+    // NOTSA: Build the lookup tables used by `LoadCdDirectory`
+    s_ModelIdsByKey.emplace((uint32)CModelInfo::NUM_MODEL_INFOS);
+    for (auto modelId = 0; modelId < CModelInfo::NUM_MODEL_INFOS; modelId++) {
+        if (const auto* const mi = CModelInfo::GetModelInfo(modelId)) {
+            s_ModelIdsByKey->InsertUnique(mi->m_nKey, (uint32)modelId);
+        }
+    }
+    s_TxdSlotsByKey.emplace((uint32)CTxdStore::ms_pTxdPool->GetSize());
+    for (auto&& [slot, txd] : CTxdStore::ms_pTxdPool->GetAllValidWithIndex()) {
+        s_TxdSlotsByKey->InsertUnique(txd.m_hash, (uint32)slot);
+    }
+
     // This is used to load the archives
     auto archiveId{0};
     for (auto& file : ms_files) {
@@ -1226,6 +1477,9 @@ void CStreaming::LoadCdDirectory()
         archiveId++;
     }
 
+    s_ModelIdsByKey.reset();
+    s_TxdSlotsByKey.reset();
+
     ///////////// unused //////////////
     ms_lastImageRead = 0;
     // ms_imageSize = ms_imageSize >> 11;
@@ -1332,11 +1586,10 @@ void CStreaming::RenderEntity(CLink<CEntity*>* streamingLink) {
 // 0x409430
 // Load big buildings around `point`
 void CStreaming::RequestBigBuildings(const CVector& point) {
-    for (auto i = GetBuildingPool()->GetSize(); i --> 0;) {
-        CBuilding* building = GetBuildingPool()->GetAt(i);
-        if (building && building->m_bIsBIGBuilding) {
-            if (CRenderer::ShouldModelBeStreamed(building, point, TheCamera.m_pRwCamera->farPlane)) {
-                RequestModel(building->m_nModelIndex, 0);
+    for (auto& building : GetBuildingPool()->GetAllValid()) { // NOTSA: Originally iterated backwards, but the order doesn't matter here
+        if (building.m_bIsBIGBuilding) {
+            if (CRenderer::ShouldModelBeStreamed(&building, point, TheCamera.m_pRwCamera->farPlane)) {
+                RequestModel(building.m_nModelIndex, 0);
             }
         }
     }
@@ -1377,6 +1630,9 @@ void CStreaming::RequestFilesInChannel(int32 chIdx) {
 void CStreaming::RequestModel(int32 modelId, int32 streamingFlags) {
     CStreamingInfo& info = GetInfo(modelId);
 
+    ms_Prefetcher.OnRequestModel(modelId); // NOTSA
+    ms_Evictor.OnRequested(modelId);       // NOTSA
+
     switch (info.m_LoadState) {
     case eStreamingLoadState::LOADSTATE_NOT_LOADED:
         break;
@@ -1451,6 +1707,8 @@ void CStreaming::RequestModel(int32 modelId, int32 streamingFlags) {
         info.ClearAllFlags();
         info.SetFlags(streamingFlags);
         info.m_LoadState = LOADSTATE_REQUESTED;
+
+        ms_Scheduler.OnRequested(modelId); // NOTSA
         break;
     }
     }
@@ -1531,6 +1789,8 @@ void CStreaming::FinishLoadingLargeFile(uint8* pFileBuffer, int32 modelId) {
         if (!bLoaded) {
             RemoveModel(modelId);
             RequestModel(modelId, streamingInfo.GetFlags());
+        } else {
+            ms_Scheduler.OnLoaded(modelId); // NOTSA
         }
     } else {
         if (IsModelDFF(modelId)) {
@@ -1905,47 +2165,22 @@ bool CStreaming::ProcessLoadingChannel(int32 chIdx) {
             if (modelId == MODEL_INVALID)
                 continue;
 
-            CBaseModelInfo* baseModelInfo = CModelInfo::GetModelInfo(modelId);
-            CStreamingInfo& info = GetInfo(modelId);
+            const auto bufferOffsetInSectors = ch.modelStreamingBufferOffsets[i];
+            auto* fileBuffer = reinterpret_cast <uint8*> (&ms_pStreamingBuffer[chIdx][STREAMING_SECTOR_SIZE * bufferOffsetInSectors]);
 
-            if (!IsModelDFF(modelId)
-                || baseModelInfo->GetModelType() != MODEL_INFO_VEHICLE /* It's a DFF, check if its a vehicle */
-                || ms_vehiclesLoaded.CountMembers() < desiredNumVehiclesLoaded /* It's a vehicle, so lets check if we can load more */
-                || RemoveLoadedVehicle() /* no, so try to remove one, and load this in its place */
-                || info.IsMissionOrGameRequired() /* failed, lets check if its absolutely mission critical */
-            ) {
-                if (!IsModelIPL(modelId)) {
-                    MakeSpaceFor(info.GetCdSize() * STREAMING_SECTOR_SIZE); // IPL's dont require any memory themselves
-                }
-                const auto bufferOffsetInSectors = ch.modelStreamingBufferOffsets[i];
-                auto* fileBuffer = reinterpret_cast <uint8*> (&ms_pStreamingBuffer[chIdx][STREAMING_SECTOR_SIZE * bufferOffsetInSectors]);
-
-                // Actually load the model into memory
-                ConvertBufferToObject(fileBuffer, modelId);
-
-                if (info.IsLoadingFinishing()) {
-                    ch.LoadStatus = eChannelState::STARTED;
-                    ch.modelStreamingBufferOffsets[i] = bufferOffsetInSectors;
-                    ch.modelIds[i] = modelId;
-                    if (i == 0)
-                        continue;
-                }
-                ch.modelIds[i] = MODEL_INVALID;
-            } else {
-                // I think at this point it's guaranteed to be a vehicle (thus its a DFF),
-                // with `STREAMING_MISSION_REQUIRED` `STREAMING_GAME_REQUIRED` flags unset.
-
-                const int32 modelTxdIdx = baseModelInfo->m_nTxdIndex;
-                RemoveModel(modelId);
+            // Actually load the model into memory
+            if (!LoadModelFromBuffer(fileBuffer, modelId)) {
+                continue;
+            }
 
-                if (info.IsMissionOrGameRequired()) {
-                    // Re-request it.
-                    // I think this code is unreachable, because
-                    // if any of the 2 flags (above) is set this code is never reached.
-                    RequestModel(modelId, info.GetFlags());
-                } else if (!CTxdStore::GetNumRefs(modelTxdIdx))
-                    RemoveTxdModel(modelTxdIdx); // Unload TXD, as it has no refs
+            if (GetInfo(modelId).IsLoadingFinishing()) {
+                ch.LoadStatus = eChannelState::STARTED;
+                ch.modelStreamingBufferOffsets[i] = bufferOffsetInSectors;
+                ch.modelIds[i] = modelId;
+                if (i == 0)
+                    continue;
             }
+            ch.modelIds[i] = MODEL_INVALID;
         }
     }
 
@@ -1959,6 +2194,69 @@ bool CStreaming::ProcessLoadingChannel(int32 chIdx) {
     return true;
 }
 
+// NOTSA: Split out of `ProcessLoadingChannel`
+bool CStreaming::LoadModelFromBuffer(uint8* fileBuffer, int32 modelId) {
+    CBaseModelInfo* baseModelInfo = CModelInfo::GetModelInfo(modelId);
+    CStreamingInfo& info = GetInfo(modelId);
+
+    if (!IsModelDFF(modelId)
+        || baseModelInfo->GetModelType() != MODEL_INFO_VEHICLE /* It's a DFF, check if its a vehicle */
+        || ms_vehiclesLoaded.CountMembers() < desiredNumVehiclesLoaded /* It's a vehicle, so lets check if we can load more */
+        || RemoveLoadedVehicle() /* no, so try to remove one, and load this in its place */
+        || info.IsMissionOrGameRequired() /* failed, lets check if its absolutely mission critical */
+    ) {
+        if (!IsModelIPL(modelId)) {
+            MakeSpaceFor(info.GetCdSize() * STREAMING_SECTOR_SIZE); // IPL's dont require any memory themselves
+        }
+        ConvertBufferToObject(fileBuffer, modelId);
+        return true;
+    }
+
+    // I think at this point it's guaranteed to be a vehicle (thus its a DFF),
+    // with `STREAMING_MISSION_REQUIRED` `STREAMING_GAME_REQUIRED` flags unset.
+
+    const int32 modelTxdIdx = baseModelInfo->m_nTxdIndex;
+    RemoveModel(modelId);
+
+    if (info.IsMissionOrGameRequired()) {
+        // Re-request it.
+        // I think this code is unreachable, because
+        // if any of the 2 flags (above) is set this code is never reached.
+        RequestModel(modelId, info.GetFlags());
+    } else if (!CTxdStore::GetNumRefs(modelTxdIdx))
+        RemoveTxdModel(modelTxdIdx); // Unload TXD, as it has no refs
+
+    return false;
+}
+
+// NOTSA
+bool CStreaming::ConvertDecodedColToObject(CFileLoader::DecodedColFile& decoded, int32 modelId) {
+    CStreamingInfo& streamingInfo = GetInfo(modelId);
+    const auto bufferSize = streamingInfo.GetCdSize() * STREAMING_SECTOR_SIZE;
+
+    const notsa::ScopeGuard recordDecodeStats{ [modelId, bufferSize, begin = std::chrono::steady_clock::now()] {
+        const auto elapsed = std::chrono::steady_clock::now() - begin;
+        ms_DecodeStats[(size_t)eModelType::COL].Add(bufferSize, elapsed);
+        ms_Evictor.OnLoaded(modelId, std::chrono::duration<float, std::milli>(elapsed).count());
+    } };
+
+    // Same as the COL case in `ConvertBufferToObject`
+    MakeSpaceFor(bufferSize);
+    CMemoryMgr::PushMemId(MEM_STREAMED_COLLISION);
+    const auto success = CColStore::LoadCol(ModelIdToCOL(modelId), decoded);
+    CMemoryMgr::PopMemId();
+    if (!success) {
+        RemoveModel(modelId);
+        RequestModel(modelId, streamingInfo.GetFlags());
+        return false;
+    }
+
+    streamingInfo.m_LoadState = LOADSTATE_LOADED;
+    ms_memoryUsedBytes += bufferSize;
+    ms_Scheduler.OnLoaded(modelId);
+    return true;
+}
+
 // 0x40C1E0
 // Call `RemoveModel` on all models in the request list except
 // those ones which have either `KEEP_IN_MEMORY` or `PRIORITY_REQUEST` flag(s) set.
@@ -1979,6 +2277,7 @@ void CStreaming::PurgeRequestList() {
 // - Unloading all scripts
 // - Deleting all RW objects
 void CStreaming::ReInit() {
+    ms_Prefetcher.Reset(); // NOTSA: Everything is removed below, that doesn't count as wasted
     CTheScripts::StreamedScripts.ReInitialise();
     FlushRequestList();
     DeleteAllRwObjects();
@@ -2123,12 +2422,11 @@ void CStreaming::RemoveAllUnusedModels() {
 // 0x4093B0
 // Remove all BIG building's RW objects and models
 void CStreaming::RemoveBigBuildings() {
-        for (auto i = GetBuildingPool()->GetSize(); i --> 0;) {
-        CBuilding* building = GetBuildingPool()->GetAt(i);
-        if (building && building->m_bIsBIGBuilding && !building->m_bImBeingRendered) {
-            building->DeleteRwObject();
-            if (!CModelInfo::GetModelInfo(building->m_nModelIndex)->m_nRefCount)
-                RemoveModel(building->m_nModelIndex);
+    for (auto& building : GetBuildingPool()->GetAllValid()) { // NOTSA: Originally iterated backwards, but the order doesn't matter here
+        if (building.m_bIsBIGBuilding && !building.m_bImBeingRendered) {
+            building.DeleteRwObject();
+            if (!CModelInfo::GetModelInfo(building.m_nModelIndex)->m_nRefCount)
+                RemoveModel(building.m_nModelIndex);
         }
     }
 }
@@ -2261,42 +2559,20 @@ void CStreaming::RemoveInappropriatePedModels() {
 // 0x40CFD0
 // The name is misleading: It just removes the first model with no references.
 bool CStreaming::RemoveLeastUsedModel(int32 streamingFlags) {
-    auto streamingInfo = ms_pEndLoadedList->GetPrev();
-    for (; streamingInfo != ms_startLoadedList; streamingInfo = streamingInfo->GetPrev()) {
-        const auto modelId = GetModelFromInfo(streamingInfo);
-        if (!streamingInfo->AreAnyFlagsSetOutOf(streamingFlags)) {
-            switch (GetModelType(modelId)) {
-            case eModelType::DFF: {
-                if (!CModelInfo::GetModelInfo(modelId)->m_nRefCount) {
-                    RemoveModel(modelId);
-                    return true;
-                }
-                break;
-            }
-            case eModelType::TXD: {
-                const auto txdId = ModelIdToTXD(modelId);
-                if (!CTxdStore::GetNumRefs(txdId) && !AreTexturesUsedByRequestedModels(txdId)) {
-                    RemoveModel(modelId);
-                    return true;
-                }
-                break;
-            }
-            case eModelType::IFP: {
-                const auto animBlockId = ModelIdToIFP(modelId);
-                if (!CAnimManager::GetNumRefsToAnimBlock(animBlockId) && !AreAnimsUsedByRequestedModels(animBlockId)) {
-                    RemoveModel(modelId);
-                    return true;
-                }
-                break;
-            }
-            case eModelType::SCM: {
-                const auto scmId = ModelIdToSCM(modelId);
-                if (!CTheScripts::StreamedScripts.m_aScripts[scmId].m_NumberOfUsers) {
-                    RemoveModel(modelId);
-                    return true;
-                }
-                break;
-            }
+    if (notsa::StreamingEvictor::GetPolicy() != notsa::StreamingEvictionPolicy::LOADED_LIST) { // NOTSA
+        if (const auto modelId = ms_Evictor.PickVictim(streamingFlags); modelId != -1) {
+            ms_Evictor.OnEvicted(modelId);
+            RemoveModel(modelId);
+            return true;
+        }
+    } else {
+        auto streamingInfo = ms_pEndLoadedList->GetPrev();
+        for (; streamingInfo != ms_startLoadedList; streamingInfo = streamingInfo->GetPrev()) {
+            const auto modelId = GetModelFromInfo(streamingInfo);
+            if (!streamingInfo->AreAnyFlagsSetOutOf(streamingFlags) && CanRemoveLoadedModel(modelId)) {
+                ms_Evictor.OnEvicted(modelId); // NOTSA
+                RemoveModel(modelId);
+                return true;
             }
         }
     }
@@ -2325,6 +2601,26 @@ bool CStreaming::RemoveLeastUsedModel(int32 streamingFlags) {
     return false;
 }
 
+// NOTSA: Extracted from `RemoveLeastUsedModel` - Whenever a model in the loaded list has no references (and thus can be removed)
+bool CStreaming::CanRemoveLoadedModel(int32 modelId) {
+    switch (GetModelType(modelId)) {
+    case eModelType::DFF:
+        return !CModelInfo::GetModelInfo(modelId)->m_nRefCount;
+    case eModelType::TXD: {
+        const auto txdId = ModelIdToTXD(modelId);
+        return !CTxdStore::GetNumRefs(txdId) && !AreTexturesUsedByRequestedModels(txdId);
+    }
+    case eModelType::IFP: {
+        const auto animBlockId = ModelIdToIFP(modelId);
+        return !CAnimManager::GetNumRefsToAnimBlock(animBlockId) && !AreAnimsUsedByRequestedModels(animBlockId);
+    }
+    case eModelType::SCM:
+        return !CTheScripts::StreamedScripts.m_aScripts[ModelIdToSCM(modelId)].m_NumberOfUsers;
+    default:
+        return false;
+    }
+}
+
 bool CStreaming::CarIsCandidateForRemoval(int32 modelId) {
     const CStreamingInfo& info = GetInfo(modelId);
     return CModelInfo::GetModelInfo(modelId)->m_nRefCount == 0 && !info.IsMissionOrGameRequired() && info.IsLoaded();
@@ -2382,6 +2678,8 @@ void CStreaming::RemoveModel(int32 modelId) {
     if (streamingInfo.m_LoadState == LOADSTATE_NOT_LOADED)
         return;
 
+    ms_Prefetcher.OnRemoveModel(modelId); // NOTSA
+
     if (streamingInfo.IsLoaded()) {
         switch (GetModelType(modelId)) {
         case eModelType::DFF: {
@@ -2532,6 +2830,7 @@ void CStreaming::ProcessEntitiesInSectorList(PtrListType& list, float posX, floa
             entity->CreateRwObject();
 
         RequestModel(entity->m_nModelIndex, streamingflags);
+        ms_Scheduler.OnRequestedAt(entity->m_nModelIndex, entityPos); // NOTSA
     }
 }
 
@@ -2566,6 +2865,7 @@ void CStreaming::ProcessEntitiesInSectorList(PtrListType& list, int32 streamingF
             entity->CreateRwObject();
 
         RequestModel(entity->m_nModelIndex, streamingFlags);
+        ms_Scheduler.OnRequestedAt(entity->m_nModelIndex, entity->GetPosition()); // NOTSA
     }
 }
 
@@ -3723,6 +4023,11 @@ void CStreaming::Update() {
             StreamVehiclesAndPeds();
             StreamZoneModels(playerPos);
         }
+        if (g_StreamingConfig.Prefetch) {
+            ms_Prefetcher.Update(); // NOTSA
+        }
+    } else if (g_StreamingConfig.Prefetch) {
+        ms_Prefetcher.CancelAll(); // NOTSA: Not going to need them anytime soon
     }
     LoadRequestedModels();
 
@@ -12,11 +12,20 @@
 #include "RenderWare.h"
 #include "LinkList.h"
 #include "constants.h"
+#include "FileLoader.h"
+#include "StreamingScheduler.h"
+#include "StreamingPrefetcher.h"
+#include "StreamingEvictor.h"
 #include <CdStreamInfo.h>
+#include <atomic>
+#include <chrono>
 
 class CEntity;
 class CLoadedCarGroup;
 class CDirectory;
+namespace notsa {
+class CdStreamAsyncReader;
+};
 
 enum class eChannelState
 {
@@ -181,6 +190,25 @@ struct tStreamingChannel {
 
 VALIDATE_SIZE(tStreamingChannel, 0x98);
 
+//! NOTSA: Throughput of decoding streamed files (See `CStreaming::ms_DecodeStats`)
+struct tStreamingDecodeStats {
+    std::atomic<uint64> NumFiles{};
+    std::atomic<uint64> NumBytes{};
+    std::atomic<uint64> NumMicroseconds{};
+
+    void Add(size_t numBytes, std::chrono::steady_clock::duration took) {
+        NumFiles++;
+        NumBytes        += numBytes;
+        NumMicroseconds += (uint64)std::chrono::duration_cast<std::chrono::microseconds>(took).count();
+    }
+
+    //! Bytes decoded per millisecond spent decoding
+    float GetBytesPerMs() const {
+        const auto us = NumMicroseconds.load();
+        return us ? (float)NumBytes.load() * 1000.f / (float)us : 0.f;
+    }
+};
+
 class CStreaming {
 public:
     static inline auto& ms_memoryAvailable = StaticRef<size_t>(0x8A5A80); // 25'600'000 == 25.6 MB
@@ -259,6 +287,21 @@ public:
     static inline auto& ms_oldSectorX = StaticRef<int32>(0x8E4B98);
     static inline auto& ms_oldSectorY = StaticRef<int32>(0x8E4B94);
 
+    //! NOTSA: Time spent in `ConvertBufferToObject` per model type (For COL's that were decoded off the main thread it's only the linking)
+    static inline std::array<tStreamingDecodeStats, (size_t)eModelType::INTERNAL_1> ms_DecodeStats{};
+
+    //! NOTSA: Time spent decoding COL's on the reader threads (See `LoadRequestedModelsAsync`)
+    static inline tStreamingDecodeStats ms_ColDecodeStatsOffThread{};
+
+    //! NOTSA: Picks the next model to read in `GetNextFileOnCd`
+    static inline notsa::StreamingScheduler ms_Scheduler{};
+
+    //! NOTSA: Requests models along the player's path ahead of time (See `Update`)
+    static inline notsa::StreamingPrefetcher ms_Prefetcher{};
+
+    //! NOTSA: Picks the model to remove in `RemoveLeastUsedModel`
+    static inline notsa::StreamingEvictor ms_Evictor{};
+
 public:
     static void InjectHooks();
 
@@ -346,6 +389,7 @@ public:
     static void RemoveEntity(CLink<CEntity*>* streamingLink);
     static void RemoveInappropriatePedModels();
     static bool RemoveLeastUsedModel(int32 flags);
+    static bool CanRemoveLoadedModel(int32 modelId); // NOTSA
     static bool CarIsCandidateForRemoval(int32 modelId);
     static bool RemoveLoadedVehicle();
     static bool RemoveLoadedZoneModel();
@@ -401,4 +445,28 @@ public:
     static bool IsRequestListEmpty() { return ms_pEndRequestedList->GetPrev() == ms_pStartRequestedList; }
     static ptrdiff_t GetModelFromInfo(const CStreamingInfo* info) { return notsa::array_indexof(ms_aInfoForModel, info); }
     static auto GetLoadedPeds() { return ms_pedsLoaded | rng::views::take(ms_numPedsLoaded); }
+
+    /*!
+     * @notsa
+     * @brief Load the requested models that can be loaded right away using `notsa::CdStreamAsyncReader`.
+     * @brief Models are read in batches with many reads in flight, and are converted as their reads complete.
+     * @brief Whatever is left (Read failures, models with unmet dependencies, etc) is up for `LoadAllRequestedModels` to load.
+     */
+    static void LoadRequestedModelsAsync(bool bOnlyPriorityRequests);
+
+    /*!
+     * @notsa
+     * @brief Split out of `ProcessLoadingChannel`: Load a model from its file's data, unless it's a vehicle that doesn't fit the loaded vehicle limit
+     * @return Whenever the model was passed on to `ConvertBufferToObject` (Otherwise it was removed)
+     */
+    static bool LoadModelFromBuffer(uint8* fileBuffer, int32 modelId);
+
+    /*!
+     * @notsa
+     * @brief `ConvertBufferToObject` for COL's decoded by `CFileLoader::DecodeCollisionFile`
+     */
+    static bool ConvertDecodedColToObject(CFileLoader::DecodedColFile& decoded, int32 modelId);
+
+    //! @notsa Get the reader used by `LoadRequestedModelsAsync` (Created on first use)
+    static notsa::CdStreamAsyncReader& GetAsyncReader();
 };
@@ -0,0 +1,148 @@
+#include "StdInc.h"
+
+#include "StreamingEvictor.h"
+#include "Streaming.h"
+
+#include "extensions/Configs/Streaming.hpp"
+
+namespace notsa {
+namespace {
+constexpr uint32 LFU_HALF_LIFE_MS    = 10'000;
+constexpr float  READ_BYTES_PER_MS   = 20'000.f; //!< Assumed read throughput for the reload cost (~20 MB/s, a slow HDD)
+constexpr float  READ_LATENCY_MS     = 1.f;      //!< Assumed latency of a single read (Seek, request list, etc)
+constexpr float  COST_DISTANCE_SCALE = 100.f;    //!< Models this far from the camera are valued half as much as ones next to it
+};
+
+StreamingEvictor::StreamingEvictor() :
+    m_Usage(RESOURCE_ID_TOTAL)
+{
+}
+
+void StreamingEvictor::OnRequested(int32 modelId) {
+    auto& u = m_Usage[modelId];
+    switch (CStreaming::GetInfo(modelId).m_LoadState) {
+    case LOADSTATE_LOADED: {
+        if (u.LastUsedFrame != CTimer::GetFrameCounter()) {
+            m_Stats.NumHits++;
+            OnUsed(u);
+        }
+        break;
+    }
+    case LOADSTATE_NOT_LOADED: {
+        m_Stats.NumMisses++;
+        if (u.EvictedAtMs && CTimer::GetTimeInMS() - u.EvictedAtMs < g_StreamingConfig.EvictionThrashWindowMs) {
+            m_Stats.NumThrashes++;
+        }
+        u.EvictedAtMs = 0;
+        break;
+    }
+    }
+}
+
+void StreamingEvictor::OnUsedAt(int32 modelId, const CVector& pos) {
+    auto& u = m_Usage[modelId];
+    if (u.LastUsedFrame != CTimer::GetFrameCounter()) {
+        OnUsed(u);
+    }
+    if (u.PosFrame != CTimer::GetFrameCounter()) {
+        u.PosFrame = CTimer::GetFrameCounter();
+        u.HasPos   = false;
+    }
+
+    // Multiple entities might use the same model, keep the closest one
+    const auto& camPos = TheCamera.GetPosition();
+    if (!u.HasPos || DistanceBetweenPointsSquared(pos, camPos) < DistanceBetweenPointsSquared(u.Pos, camPos)) {
+        u.Pos    = pos;
+        u.HasPos = true;
+    }
+}
+
+void StreamingEvictor::OnLoaded(int32 modelId, float loadTimeMs) {
+    auto& u = m_Usage[modelId];
+    u.LoadTimeMs = loadTimeMs;
+    u.HasPos     = false;
+    OnUsed(u);
+}
+
+void StreamingEvictor::OnEvicted(int32 modelId) {
+    m_Stats.NumEvictions++;
+    m_Usage[modelId].EvictedAtMs = CTimer::GetTimeInMS() | 1; // Never 0, that means "not evicted"
+}
+
+int32 StreamingEvictor::PickVictim(int32 streamingFlags) {
+    ZoneScoped;
+
+    assert(GetPolicy() != StreamingEvictionPolicy::LOADED_LIST);
+
+    // Only look at the least recently requested part of the list, otherwise `MakeSpaceFor` would be quadratic
+    int32  victim = -1;
+    float  victimScore{};
+    uint32 numCandidates{};
+    for (auto* info = CStreaming::ms_pEndLoadedList->GetPrev(); info != CStreaming::ms_startLoadedList; info = info->GetPrev()) {
+        const auto modelId = (int32)CStreaming::GetModelFromInfo(info);
+        if (info->AreAnyFlagsSetOutOf(streamingFlags) || !CStreaming::CanRemoveLoadedModel(modelId)) {
+            continue;
+        }
+        if (const auto score = GetScore(modelId); victim == -1 || score < victimScore) {
+            victim      = modelId;
+            victimScore = score;
+        }
+        if (++numCandidates >= g_StreamingConfig.EvictionMaxCandidates) {
+            break;
+        }
+    }
+    return victim;
+}
+
+float StreamingEvictor::GetScore(int32 modelId) const {
+    const auto& u = m_Usage[modelId];
+    switch (GetPolicy()) {
+    case StreamingEvictionPolicy::LRU:
+        return -(float)(CTimer::GetTimeInMS() - u.LastUsedMs); // Oldest first
+    case StreamingEvictionPolicy::LFU:
+        return GetUseCount(u);
+    case StreamingEvictionPolicy::COST: {
+        const auto ageS     = (float)(CTimer::GetTimeInMS() - u.LastUsedMs) / 1000.f;
+        const auto recency  = 1.f / (1.f + ageS);
+        const auto nearness = u.HasPos
+            ? 1.f / (1.f + DistanceBetweenPoints(u.Pos, TheCamera.GetPosition()) / COST_DISTANCE_SCALE)
+            : 1.f;
+        return GetReloadCostMs(modelId) * recency * nearness;
+    }
+    default:
+        return 0.f;
+    }
+}
+
+StreamingEvictionPolicy StreamingEvictor::GetPolicy() {
+    return (StreamingEvictionPolicy)std::min(g_StreamingConfig.EvictionPolicy, (uint32)StreamingEvictionPolicy::COST);
+}
+
+const char* StreamingEvictor::GetPolicyName(StreamingEvictionPolicy policy) {
+    switch (policy) {
+    case StreamingEvictionPolicy::LOADED_LIST: return "Loaded list (Vanilla)";
+    case StreamingEvictionPolicy::LRU:         return "LRU";
+    case StreamingEvictionPolicy::LFU:         return "LFU";
+    case StreamingEvictionPolicy::COST:        return "Cost";
+    default:                                   NOTSA_UNREACHABLE();
+    }
+}
+
+void StreamingEvictor::OnUsed(ModelUsage& u) {
+    const auto nowMs = CTimer::GetTimeInMS();
+    u.UseCount      = (uint32)GetUseCount(u) + 1;
+    u.UseCountEpoch = nowMs / LFU_HALF_LIFE_MS;
+    u.LastUsedMs    = nowMs;
+    u.LastUsedFrame = CTimer::GetFrameCounter();
+}
+
+float StreamingEvictor::GetUseCount(const ModelUsage& u) const {
+    const auto numHalvings = CTimer::GetTimeInMS() / LFU_HALF_LIFE_MS - u.UseCountEpoch;
+    return numHalvings >= 32 ? 0.f : (float)(u.UseCount >> numHalvings);
+}
+
+float StreamingEvictor::GetReloadCostMs(int32 modelId) const {
+    const auto sizeBytes = (float)(CStreaming::GetInfo(modelId).GetCdSize() * STREAMING_SECTOR_SIZE);
+    return READ_LATENCY_MS + sizeBytes / READ_BYTES_PER_MS + m_Usage[modelId].LoadTimeMs;
+}
+}; // namespace notsa
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <vector>
+
+#include "Vector.h"
+
+namespace notsa {
+//! NOTSA: How `CStreaming::RemoveLeastUsedModel` picks the model to remove
+enum class StreamingEvictionPolicy : uint32 {
+    LOADED_LIST, //!< Vanilla: The first removable model from the back of the loaded list
+    LRU,         //!< Least recently used
+    LFU,         //!< Least frequently used (Frequency halves every `LFU_HALF_LIFE_MS`)
+    COST,        //!< Cheapest to reload, weighted by recency and distance to the camera
+
+    NUM
+};
+
+/*!
+ * @brief NOTSA: Keeps track of how streamed models are used, and picks which one to remove when memory is needed.
+ *
+ * Vanilla evicts by walking the loaded list (Which is roughly LRU ordered, as `RequestModel` moves models to the front of it),
+ * without any notion of how expensive it'd be to load the model again. See `StreamingEvictionPolicy` for the alternatives.
+ * The policy is selected by `StreamingConfig::EvictionPolicy` and can be changed at runtime.
+ */
+class StreamingEvictor {
+public:
+    struct Stats {
+        uint64 NumHits{};      //!< Number of times an already loaded model was requested (At most once per model per frame)
+        uint64 NumMisses{};    //!< Number of times a not loaded model was requested
+        uint64 NumEvictions{}; //!< Number of models removed by `CStreaming::RemoveLeastUsedModel`
+        uint64 NumThrashes{};  //!< Number of misses on models that were evicted recently (See `StreamingConfig::EvictionThrashWindowMs`)
+
+        float GetHitRate() const { return NumHits + NumMisses ? (float)NumHits / (float)(NumHits + NumMisses) : 0.f; }
+    };
+
+public:
+    StreamingEvictor();
+
+    //! Called by `CStreaming::RequestModel` (Before the model's state is changed)
+    void OnRequested(int32 modelId);
+
+    //! A loaded model is used by an entity at `pos` (Called by the renderer)
+    void OnUsedAt(int32 modelId, const CVector& pos);
+
+    //! A model has finished loading, `loadTimeMs` is how long it took to convert (Excluding the read)
+    void OnLoaded(int32 modelId, float loadTimeMs);
+
+    //! A model has been removed by `CStreaming::RemoveLeastUsedModel`
+    void OnEvicted(int32 modelId);
+
+    /*!
+     * @brief Pick the model to remove using the current policy (Mustn't be `LOADED_LIST`)
+     * @param streamingFlags Models with any of these flags set are skipped
+     * @return The model ID, or -1 if none of the models in the loaded list can be removed
+     */
+    int32 PickVictim(int32 streamingFlags);
+
+    //! Score of a loaded model according to the current policy - Lower is removed first
+    float GetScore(int32 modelId) const;
+
+    static StreamingEvictionPolicy GetPolicy();
+    static const char*             GetPolicyName(StreamingEvictionPolicy policy);
+
+    const Stats& GetStats() const { return m_Stats; }
+    void ResetStats() { m_Stats = {}; }
+
+private:
+    struct ModelUsage {
+        CVector Pos{};              //!< Closest position (to the camera) the model was used at in `PosFrame`
+        uint32  PosFrame{};
+        uint32  LastUsedMs{};       //!< Game time of the last use
+        uint32  LastUsedFrame{};    //!< Frame of the last use (Hits are counted once per frame)
+        uint32  UseCount{};         //!< Number of frames used in (Halved every `LFU_HALF_LIFE_MS`, see `GetUseCount`)
+        uint32  UseCountEpoch{};    //!< Epoch `UseCount` was last updated in
+        uint32  EvictedAtMs{};      //!< Game time it was evicted at (0 if it wasn't)
+        float   LoadTimeMs{};       //!< How long converting it took the last time
+        bool    HasPos{};
+    };
+
+    void  OnUsed(ModelUsage& u);
+    float GetUseCount(const ModelUsage& u) const;
+    float GetReloadCostMs(int32 modelId) const;
+
+private:
+    std::vector<ModelUsage> m_Usage{}; //!< Indexed by model ID
+    Stats                   m_Stats{};
+};
+}; // namespace notsa
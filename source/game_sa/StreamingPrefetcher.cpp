@@ -0,0 +1,306 @@
+#include "StdInc.h"
+
+#include "StreamingPrefetcher.h"
+#include "Streaming.h"
+#include "PathFind.h"
+#include "Radar.h"
+#include "MenuManager.h"
+
+#include "extensions/Configs/Streaming.hpp"
+
+namespace notsa {
+namespace {
+constexpr uint32 ROUTE_UPDATE_INTERVAL_MS = 1000; //!< How often the route to the map target is recalculated
+constexpr int32  MAX_ROUTE_NODES          = 64;   //!< Max. number of route nodes followed
+constexpr size_t MAX_LOOK_AHEAD_POINTS    = 16;
+constexpr float  STALE_RADIUS_MULT        = 1.5f; //!< Requests further than this times `PrefetchRadius` from all look-ahead points are cancelled
+constexpr uint32 MAX_MEMORY_USED_PERCENT  = 75;   //!< Nothing is prefetched above this much streaming memory usage
+};
+
+StreamingPrefetcher::StreamingPrefetcher() :
+    m_Prefetched(RESOURCE_ID_TOTAL)
+{
+}
+
+void StreamingPrefetcher::Update() {
+    ZoneScoped;
+
+    m_Points.clear();
+    m_WantedCols.clear();
+
+    const auto* const player = static_cast<CPhysical*>(FindPlayerEntity());
+    if (!player) {
+        CancelAll();
+        return;
+    }
+    const auto& playerPos = player->GetPosition();
+    const auto  velocity  = CVector{ player->GetMoveSpeed().x, player->GetMoveSpeed().y, 0.f } * 50.f; // Units/timestep => Units/s (Horizontal only)
+    const auto  speed     = velocity.Magnitude();
+
+    // The player's position is always a look-ahead point, so that requests that got close already aren't cancelled
+    m_Points.emplace_back(playerPos);
+
+    const auto* const vehicle = FindPlayerVehicle();
+    UpdateRoute(playerPos, vehicle != nullptr, vehicle && vehicle->IsBoat());
+
+    if (speed >= g_StreamingConfig.PrefetchMinSpeed) {
+        const auto lookAheadDist = speed * g_StreamingConfig.PrefetchSeconds;
+        if (m_IsFollowingRoute) {
+            GatherPointsAlongRoute(playerPos, lookAheadDist);
+        } else {
+            GatherPointsAlongVelocity(playerPos, velocity, lookAheadDist);
+        }
+    }
+
+    CancelStale();
+
+    if (m_Points.size() == 1) {
+        return; // Standing still, the regular streaming takes care of the surroundings
+    }
+    if (CStreaming::IsVeryBusy() || GetNumPending() >= g_StreamingConfig.PrefetchMaxPending) {
+        return;
+    }
+    if ((uint64)CStreaming::ms_memoryUsedBytes * 100 >= (uint64)CStreaming::ms_memoryAvailable * MAX_MEMORY_USED_PERCENT) {
+        return;
+    }
+    for (const auto& point : m_Points | rngv::drop(1)) {
+        PrefetchAround(point);
+    }
+}
+
+void StreamingPrefetcher::CancelAll() {
+    m_Points.clear();
+    m_WantedCols.clear();
+    CancelStale();
+}
+
+void StreamingPrefetcher::Reset() {
+    for (const auto modelId : m_Tracked) {
+        m_Prefetched[modelId] = {};
+    }
+    m_Tracked.clear();
+    m_WantedCols.clear();
+    m_Route.clear();
+    m_IsFollowingRoute = false;
+}
+
+void StreamingPrefetcher::OnRequestModel(int32 modelId) {
+    auto& p = m_Prefetched[modelId];
+    if (m_IsRequesting) {
+        // Us, or a dependency of the model we've requested - Only track it if it's going to be loaded because of us
+        if (!p.IsTracked && CStreaming::GetInfo(modelId).m_LoadState == LOADSTATE_NOT_LOADED) {
+            p.Pos       = m_RequestPos;
+            p.IsTracked = true;
+            if (!std::exchange(p.InList, true)) {
+                m_Tracked.push_back(modelId);
+            }
+
+            m_Stats.NumPrefetched++;
+            m_Stats.NumPrefetchedBytes += GetSizeInBytes(modelId);
+        }
+    } else if (p.IsTracked) {
+        // The game needs it, so from now on it's not ours
+        m_Stats.NumHits++;
+        m_Stats.NumHitBytes += GetSizeInBytes(modelId);
+        Untrack(modelId);
+    }
+}
+
+void StreamingPrefetcher::OnRemoveModel(int32 modelId) {
+    if (!m_Prefetched[modelId].IsTracked) {
+        return;
+    }
+    if (CStreaming::GetInfo(modelId).m_LoadState == LOADSTATE_REQUESTED) {
+        m_Stats.NumCancelled++;
+        m_Stats.NumCancelledBytes += GetSizeInBytes(modelId);
+    } else { // Read already
+        m_Stats.NumWasted++;
+        m_Stats.NumWastedBytes += GetSizeInBytes(modelId);
+    }
+    Untrack(modelId);
+}
+
+bool StreamingPrefetcher::IsCollisionWanted(int32 colSlot) const {
+    return rng::find(m_WantedCols, colSlot) != m_WantedCols.end();
+}
+
+uint32 StreamingPrefetcher::GetNumPending() const {
+    return (uint32)rng::count_if(m_Tracked, [this](int32 modelId) {
+        return m_Prefetched[modelId].IsTracked && CStreaming::GetInfo(modelId).m_LoadState == LOADSTATE_REQUESTED;
+    });
+}
+
+void StreamingPrefetcher::UpdateRoute(const CVector& playerPos, bool inVehicle, bool forBoats) {
+    // Find the map target (if any)
+    const auto blipIdx = inVehicle
+        ? CRadar::GetActualBlipArrayIndex(FrontEndMenuManager.m_nTargetBlipIndex)
+        : -1;
+    if (blipIdx == -1 || CRadar::ms_RadarTrace[blipIdx].m_nBlipDisplayFlag == BLIP_DISPLAY_NEITHER) {
+        m_Route.clear();
+        m_IsFollowingRoute = false;
+        return;
+    }
+    const auto& target = CRadar::ms_RadarTrace[blipIdx].m_vPosition;
+
+    const auto nowMs = CTimer::GetTimeInMS();
+    if (m_IsFollowingRoute && target == m_RouteTarget && nowMs - m_RouteUpdatedAtMs < ROUTE_UPDATE_INTERVAL_MS) {
+        return;
+    }
+    m_RouteTarget      = target;
+    m_RouteUpdatedAtMs = nowMs;
+
+    // Target is likely outside the loaded path areas, in which case the route goes towards the node closest to it
+    CNodeAddress nodes[MAX_ROUTE_NODES];
+    int16        numNodes{};
+    ThePaths.DoPathSearch(
+        PATH_TYPE_VEH,
+        playerPos,
+        CNodeAddress{},
+        target,
+        nodes,
+        numNodes,
+        MAX_ROUTE_NODES,
+        nullptr,
+        999999.9f,
+        nullptr,
+        999999.9f,
+        false,
+        CNodeAddress{},
+        false,
+        forBoats
+    );
+    m_Route.assign(nodes, nodes + numNodes);
+    m_IsFollowingRoute = numNodes > 1;
+}
+
+void StreamingPrefetcher::GatherPointsAlongRoute(const CVector& playerPos, float lookAheadDist) {
+    const auto spacing = g_StreamingConfig.PrefetchRadius;
+
+    // Walk the route placing a point every `spacing` units
+    auto  prev     = playerPos;
+    float distance = 0.f, sinceLastPoint = 0.f;
+    for (const auto& addr : m_Route) {
+        if (!ThePaths.IsAreaNodesAvailable(addr)) {
+            break;
+        }
+        const auto pos = ThePaths.GetPathNode(addr)->GetPosition();
+        const auto len = DistanceBetweenPoints2D(prev, pos);
+        distance       += len;
+        sinceLastPoint += len;
+        prev            = pos;
+        if (sinceLastPoint >= spacing) {
+            m_Points.emplace_back(pos);
+            sinceLastPoint = 0.f;
+        }
+        if (distance >= lookAheadDist || m_Points.size() >= MAX_LOOK_AHEAD_POINTS) {
+            return;
+        }
+    }
+    if (sinceLastPoint > 0.f && m_Points.size() < MAX_LOOK_AHEAD_POINTS) {
+        m_Points.emplace_back(prev); // End of the (loaded part of the) route
+    }
+}
+
+void StreamingPrefetcher::GatherPointsAlongVelocity(const CVector& playerPos, const CVector& velocity, float lookAheadDist) {
+    const auto dir     = velocity.Normalized();
+    const auto spacing = g_StreamingConfig.PrefetchRadius;
+    for (auto dist = spacing; dist <= lookAheadDist && m_Points.size() < MAX_LOOK_AHEAD_POINTS; dist += spacing) {
+        m_Points.emplace_back(playerPos + dir * dist);
+    }
+}
+
+void StreamingPrefetcher::CancelStale() {
+    const auto staleRadius = g_StreamingConfig.PrefetchRadius * STALE_RADIUS_MULT;
+    for (const auto modelId : m_Tracked) {
+        const auto& p = m_Prefetched[modelId];
+        if (!p.IsTracked) {
+            continue;
+        }
+        const auto& info = CStreaming::GetInfo(modelId);
+        if (info.m_LoadState != LOADSTATE_REQUESTED || info.IsRequiredToBeKept() || info.IsPriorityRequest()) {
+            continue; // Too late, or someone else wants it too
+        }
+        const auto isNearPath = rng::any_of(m_Points, [&](const CVector& point) {
+            return DistanceBetweenPoints2D(point, p.Pos) <= staleRadius;
+        });
+        if (!isNearPath) {
+            CStreaming::RemoveModel(modelId); // Calls `OnRemoveModel`
+        }
+    }
+    std::erase_if(m_Tracked, [this](int32 modelId) {
+        auto& p = m_Prefetched[modelId];
+        if (p.IsTracked) {
+            return false;
+        }
+        p.InList = false;
+        return true;
+    });
+}
+
+void StreamingPrefetcher::PrefetchAround(const CVector& point) {
+    const auto radius = g_StreamingConfig.PrefetchRadius;
+
+    // Models
+    CWorld::IterateSectorsOverlappedByRect(CRect{ point, radius }, [&](int32 x, int32 y) {
+        if (x < 0 || y < 0 || x >= MAX_SECTORS_X || y >= MAX_SECTORS_Y) {
+            return true;
+        }
+        const auto ProcessList = [&](auto& list) {
+            for (auto* const entity : list) {
+                const auto modelId = entity->m_nModelIndex;
+                if (CStreaming::GetInfo(modelId).m_LoadState != LOADSTATE_NOT_LOADED) {
+                    continue;
+                }
+                if (entity->m_bDontStream || !entity->m_bIsVisible || !entity->IsInCurrentArea()) {
+                    continue;
+                }
+                const auto* const mi = CModelInfo::GetModelInfo(modelId);
+                if (const auto* const ti = mi->GetTimeInfo(); ti && !ti->IsVisibleNow()) {
+                    continue;
+                }
+                const auto& entityPos = entity->GetPosition();
+                if (!IsPointInCircle2D(entityPos, point, std::min(TheCamera.m_fLODDistMultiplier * mi->m_fDrawDistance, radius))) {
+                    continue;
+                }
+                Prefetch(modelId, entityPos);
+            }
+        };
+        auto& sector = CWorld::GetSector(x, y);
+        ProcessList(sector.Buildings);
+        ProcessList(sector.Dummies);
+        return true;
+    });
+
+    // Collision (Only outside, same as `SetIfCollisionIsRequired` does)
+    auto& colPool = *CColStore::GetPool();
+    for (auto slot = 1; slot < (int32)colPool.GetSize(); slot++) {
+        const auto* const def = colPool.GetAt(slot);
+        if (!def || def->m_bInterior || !def->m_Area.IsPointInside(point)) {
+            continue;
+        }
+        if (!IsCollisionWanted(slot)) {
+            m_WantedCols.push_back(slot);
+        }
+        if (!def->m_bActive) {
+            Prefetch(COLToModelId(slot), point);
+        }
+    }
+}
+
+void StreamingPrefetcher::Prefetch(int32 modelId, const CVector& pos) {
+    m_IsRequesting = true;
+    m_RequestPos   = pos;
+    CStreaming::RequestModel(modelId, 0); // No priority
+    m_IsRequesting = false;
+
+    CStreaming::ms_Scheduler.OnRequestedAt(modelId, pos);
+}
+
+void StreamingPrefetcher::Untrack(int32 modelId) {
+    m_Prefetched[modelId].IsTracked = false; // Removed from `m_Tracked` lazily
+}
+
+uint32 StreamingPrefetcher::GetSizeInBytes(int32 modelId) {
+    return CStreaming::GetInfo(modelId).GetCdSize() * STREAMING_SECTOR_SIZE;
+}
+}; // namespace notsa
@@ -0,0 +1,102 @@
+#pragma once
+
+#include <vector>
+
+#include "Vector.h"
+#include "NodeAddress.h"
+
+namespace notsa {
+/*!
+ * @brief NOTSA: Requests the models and collision the player is going to need a few seconds from now.
+ *
+ * The renderer only requests what's inside the frustum, so when moving fast models at the leading edge
+ * arrive late. This looks ahead along the player's path - Either by extrapolating the current velocity,
+ * or (If the player is in a vehicle and has a map target set) by following the `CPathFind` route to the target.
+ * Models of the buildings and dummies around the look-ahead points are then requested without the priority flag,
+ * so they're read when there's nothing more urgent (See `StreamingScheduler`).
+ *
+ * Once the path changes (The player turned, or the route did) the requests that aren't near it anymore,
+ * and haven't been read yet are cancelled.
+ */
+class StreamingPrefetcher {
+public:
+    struct Stats {
+        uint64 NumPrefetched{};      //!< Number of models requested by the prefetcher
+        uint64 NumPrefetchedBytes{};
+        uint64 NumHits{};            //!< Number of prefetched models that were requested by the game afterwards
+        uint64 NumHitBytes{};
+        uint64 NumWasted{};          //!< Number of prefetched models that were read, but removed before being used
+        uint64 NumWastedBytes{};
+        uint64 NumCancelled{};       //!< Number of prefetched models that were removed before being read
+        uint64 NumCancelledBytes{};
+
+        //! Fraction of the resolved (hit or wasted) prefetches that were hits
+        float GetHitRate() const { return NumHits + NumWasted ? (float)NumHits / (float)(NumHits + NumWasted) : 0.f; }
+    };
+
+public:
+    StreamingPrefetcher();
+
+    //! Update the look-ahead path and request/cancel models (Called from `CStreaming::Update`)
+    void Update();
+
+    //! Cancel all prefetch requests that haven't been read yet
+    void CancelAll();
+
+    //! Forget all prefetched models without touching them (Eg.: Everything is about to be removed anyways)
+    void Reset();
+
+    //! Called at the start of `CStreaming::RequestModel`
+    void OnRequestModel(int32 modelId);
+
+    //! Called by `CStreaming::RemoveModel` (Before the model is actually removed)
+    void OnRemoveModel(int32 modelId);
+
+    //! Whenever the prefetcher wants this collision slot to stay loaded
+    bool IsCollisionWanted(int32 colSlot) const;
+
+    //! The current look-ahead points (The first one is the player's position)
+    const auto& GetLookAheadPoints() const { return m_Points; }
+
+    //! Whenever the look-ahead points are from the route to the map target
+    bool IsFollowingRoute() const { return m_IsFollowingRoute; }
+
+    //! Number of prefetched models that haven't been read yet
+    uint32 GetNumPending() const;
+
+    const Stats& GetStats() const { return m_Stats; }
+    void ResetStats() { m_Stats = {}; }
+
+private:
+    struct Prefetched {
+        CVector Pos{};       //!< Where it was prefetched for
+        bool    IsTracked{}; //!< Whenever it was prefetched, and hasn't been used or removed since
+        bool    InList{};    //!< Whenever it's in `m_Tracked`
+    };
+
+    void UpdateRoute(const CVector& playerPos, bool inVehicle, bool forBoats);
+    void GatherPointsAlongRoute(const CVector& playerPos, float lookAheadDist);
+    void GatherPointsAlongVelocity(const CVector& playerPos, const CVector& velocity, float lookAheadDist);
+    void CancelStale();
+    void PrefetchAround(const CVector& point);
+    void Prefetch(int32 modelId, const CVector& pos);
+    void Untrack(int32 modelId);
+    static uint32 GetSizeInBytes(int32 modelId);
+
+private:
+    std::vector<Prefetched> m_Prefetched{}; //!< Indexed by model ID
+    std::vector<int32>      m_Tracked{};    //!< Model IDs with `IsTracked` set (May contain some that were untracked since, see `InList`)
+    std::vector<int32>      m_WantedCols{}; //!< Collision slots around the current look-ahead points
+    std::vector<CVector>    m_Points{};     //!< Current look-ahead points
+
+    std::vector<CNodeAddress> m_Route{};
+    CVector                   m_RouteTarget{};
+    uint32                    m_RouteUpdatedAtMs{};
+    bool                      m_IsFollowingRoute{};
+
+    CVector m_RequestPos{};     //!< Position passed to `Prefetch` by the current `CStreaming::RequestModel` call
+    bool    m_IsRequesting{};   //!< Whenever we're inside `CStreaming::RequestModel`
+
+    Stats m_Stats{};
+};
+}; // namespace notsa
@@ -0,0 +1,155 @@
+#include "StdInc.h"
+
+#include "StreamingScheduler.h"
+#include "Streaming.h"
+
+#include "extensions/Configs/Streaming.hpp"
+
+namespace notsa {
+namespace {
+// Score weights - A priority request always beats a non-priority one, the rest are roughly in the [0, 1] range
+constexpr float SCORE_PRIORITY    = 100.f;
+constexpr float SCORE_SCREEN_SIZE = 4.f;  //!< Times the bounding radius / distance ratio (Clamped to 1)
+constexpr float SCORE_ARRIVAL     = 2.f;  //!< Times 1 / (1 + seconds until the player arrives)
+constexpr float SCORE_DISTANCE    = 1.f;  //!< Times 1 / (1 + distance / 50)
+constexpr float SCORE_NO_POS      = 1.f;  //!< For requests without a position (Script, population, etc) - These are usually needed right away
+constexpr float SCORE_DEADLINE    = 1.f;  //!< Times the fraction of the deadline elapsed (Keeps growing once overdue)
+};
+
+StreamingScheduler::StreamingScheduler() :
+    m_Requests(RESOURCE_ID_TOTAL)
+{
+}
+
+uint32 StreamingScheduler::GetTimeMs() {
+    // Real time, as the game timer doesn't advance during `LoadAllRequestedModels`
+    using namespace std::chrono;
+    return (uint32)duration_cast<milliseconds>(steady_clock::now().time_since_epoch()).count() | 1; // Never 0, that means "not requested"
+}
+
+void StreamingScheduler::OnRequested(int32 modelId) {
+    m_Requests[modelId] = RequestInfo{ .RequestedAtMs = GetTimeMs() };
+    m_Stats.MaxQueueDepth = std::max(m_Stats.MaxQueueDepth, (uint32)CStreaming::ms_numModelsRequested);
+}
+
+void StreamingScheduler::OnRequestedAt(int32 modelId, const CVector& pos) {
+    auto& r = m_Requests[modelId];
+    if (!r.RequestedAtMs) {
+        return; // Not (or no longer) requested
+    }
+
+    // Multiple entities might use the same model, keep the closest one
+    const auto& camPos = TheCamera.GetPosition();
+    if (!r.HasPos || DistanceBetweenPointsSquared(pos, camPos) < DistanceBetweenPointsSquared(r.Pos, camPos)) {
+        r.Pos    = pos;
+        r.HasPos = true;
+    }
+}
+
+void StreamingScheduler::OnDependencyRequested(int32 depModelId, int32 modelId) {
+    const auto& r = m_Requests[modelId];
+    if (r.HasPos) {
+        OnRequestedAt(depModelId, r.Pos);
+    }
+}
+
+void StreamingScheduler::OnLoaded(int32 modelId) {
+    auto& r = m_Requests[modelId];
+    if (!r.RequestedAtMs) {
+        return; // Wasn't requested (Loaded directly, eg.: `RequestSpecialModel`)
+    }
+
+    const auto latencyMs = GetTimeMs() - r.RequestedAtMs;
+    m_Stats.NumLoaded++;
+    m_Stats.TotalLatencyMs += latencyMs;
+    m_Stats.MaxLatencyMs    = std::max(m_Stats.MaxLatencyMs, latencyMs);
+    if (latencyMs > g_StreamingConfig.SchedulerDeadlineMs) {
+        m_Stats.NumMissedDeadlines++;
+    }
+
+    r = {};
+}
+
+void StreamingScheduler::BeginPick(uint32 lastPosn) {
+    m_Candidates.clear();
+    m_LastPosn = lastPosn;
+    m_NowMs    = GetTimeMs();
+    m_CamPos   = TheCamera.GetPosition();
+    if (const auto* const player = static_cast<CPhysical*>(FindPlayerEntity())) {
+        m_PlayerVelocity = player->GetMoveSpeed() * 50.f; // Units/timestep => Units/s
+    } else {
+        m_PlayerVelocity = CVector{}; // No player (yet)
+    }
+}
+
+void StreamingScheduler::AddCandidate(int32 modelId, uint32 offset) {
+    m_Candidates.emplace_back(Candidate{ modelId, offset, GetScore(modelId) });
+}
+
+int32 StreamingScheduler::EndPick(int32 diskOrderModelId) {
+    if (m_Candidates.empty()) {
+        return diskOrderModelId;
+    }
+    m_Stats.NumPicks++;
+
+    const auto& best = *rng::max_element(m_Candidates, {}, &Candidate::Score);
+
+    // Prefer the closest request after the last read that is good enough, so reads stay sequential
+    const Candidate* local = nullptr;
+    const auto       minLocalScore = best.Score * g_StreamingConfig.SchedulerLocalityMinScore;
+    for (const auto& c : m_Candidates) {
+        if (c.Offset < m_LastPosn || c.Offset - m_LastPosn > g_StreamingConfig.SchedulerLocalityWindow) {
+            continue;
+        }
+        if (c.Score < minLocalScore) {
+            continue;
+        }
+        if (!local || c.Offset < local->Offset) {
+            local = &c;
+        }
+    }
+
+    const auto picked = local ? local->ModelId : best.ModelId;
+    if (picked != diskOrderModelId) {
+        m_Stats.NumReordered++;
+    }
+    return picked;
+}
+
+float StreamingScheduler::GetScore(int32 modelId) const {
+    const auto& r    = m_Requests[modelId];
+    const auto& info = CStreaming::GetInfo(modelId);
+
+    float score = 0.f;
+    if (info.IsPriorityRequest()) {
+        score += SCORE_PRIORITY;
+    }
+    if (r.RequestedAtMs) {
+        score += SCORE_DEADLINE * (float)(m_NowMs - r.RequestedAtMs) / (float)std::max(g_StreamingConfig.SchedulerDeadlineMs, 1u);
+    }
+    if (!r.HasPos) {
+        return score + SCORE_NO_POS;
+    }
+
+    const auto toModel = r.Pos - m_CamPos;
+    const auto dist    = std::max(toModel.Magnitude(), 1.f);
+
+    // Screen size
+    if (IsModelDFF(modelId)) {
+        if (const auto* const cm = CModelInfo::GetModelInfo(modelId)->GetColModel()) {
+            score += SCORE_SCREEN_SIZE * std::min(cm->GetBoundRadius() / dist, 1.f);
+        }
+    }
+
+    // Arrival time
+    const auto closingSpeed = DotProduct(m_PlayerVelocity, toModel) / dist;
+    if (closingSpeed > 0.f) {
+        score += SCORE_ARRIVAL / (1.f + dist / closingSpeed);
+    }
+
+    // Distance
+    score += SCORE_DISTANCE / (1.f + dist / 50.f);
+
+    return score;
+}
+}; // namespace notsa
@@ -0,0 +1,98 @@
+#pragma once
+
+#include <vector>
+
+#include "Vector.h"
+
+namespace notsa {
+/*!
+ * @brief NOTSA: Decides which requested model `CStreaming::GetNextFileOnCd` should read next.
+ *
+ * Vanilla just reads whatever is next on disk. Instead, each request is scored by how urgently it's needed:
+ * - How big it is on screen (Bounding radius / distance to the camera)
+ * - How soon the player is going to get there (Given their current velocity)
+ * - How long it has been waiting for (Relative to the deadline, see `StreamingConfig::SchedulerDeadlineMs`)
+ * - Whenever it's a priority request
+ *
+ * To keep the reads batched by disk locality, a request that is shortly after the last read
+ * is still picked over the best scoring one, as long as it scores high enough.
+ */
+class StreamingScheduler {
+public:
+    struct Stats {
+        uint64 NumLoaded{};          //!< Number of requests that got loaded
+        uint64 TotalLatencyMs{};     //!< Sum of the time from request to loaded
+        uint32 MaxLatencyMs{};       //!< Longest time from request to loaded
+        uint64 NumMissedDeadlines{}; //!< Number of requests that got loaded after their deadline
+        uint64 NumPicks{};           //!< Number of times the next model was picked
+        uint64 NumReordered{};       //!< Number of picks that differ from what vanilla would've read
+        uint32 MaxQueueDepth{};      //!< Max. number of requests seen at once
+
+        float GetAvgLatencyMs() const { return NumLoaded ? (float)TotalLatencyMs / (float)NumLoaded : 0.f; }
+    };
+
+public:
+    StreamingScheduler();
+
+    //! A model was added to the request list
+    void OnRequested(int32 modelId);
+
+    //! A model was requested for an entity at `pos` (Called after `OnRequested`)
+    void OnRequestedAt(int32 modelId, const CVector& pos);
+
+    //! `depModelId` was requested because `modelId` depends on it, so it inherits `modelId`'s position
+    void OnDependencyRequested(int32 depModelId, int32 modelId);
+
+    //! A requested model has been loaded
+    void OnLoaded(int32 modelId);
+
+    /*!
+     * @brief Start picking the next model to read
+     * @param lastPosn Position after the last read (Same value as `GetNextFileOnCd` gets)
+     */
+    void BeginPick(uint32 lastPosn);
+
+    //! Add a model that can be read now, `offset` is it's position on the disk (Same space as `lastPosn`)
+    void AddCandidate(int32 modelId, uint32 offset);
+
+    /*!
+     * @brief Finish picking
+     * @param diskOrderModelId The model vanilla would read
+     * @return The model to read
+     */
+    int32 EndPick(int32 diskOrderModelId);
+
+    //! Score of a requested model (Higher is more urgent)
+    float GetScore(int32 modelId) const;
+
+    const Stats& GetStats() const { return m_Stats; }
+    void ResetStats() { m_Stats = {}; }
+
+private:
+    struct RequestInfo {
+        CVector Pos{};
+        uint32  RequestedAtMs{}; //!< 0 if not requested (Or not tracked)
+        bool    HasPos{};
+    };
+
+    struct Candidate {
+        int32  ModelId;
+        uint32 Offset;
+        float  Score;
+    };
+
+    static uint32 GetTimeMs();
+
+private:
+    std::vector<RequestInfo> m_Requests{};   //!< Indexed by model ID
+    std::vector<Candidate>   m_Candidates{}; //!< Of the current pick
+
+    // Sampled in `BeginPick`
+    uint32  m_LastPosn{};
+    uint32  m_NowMs{};
+    CVector m_CamPos{};
+    CVector m_PlayerVelocity{}; //!< In units/s
+
+    Stats m_Stats{};
+};
+}; // namespace notsa
@@ -26,6 +26,9 @@ public:
 
     void SetCount(int32 count) { Count = count; }
 
+    //! NOTSA: Whether the next `Tick` will trigger
+    bool IsDue() const { return Count == 0; }
+
 private:
     int32 Count;
     int32 Period;
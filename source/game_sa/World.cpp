@@ -7,6 +7,8 @@
 #include "StdInc.h"
 
 #include "World.h"
+#include "extensions/Configs/World.hpp"
+#include "ContactCache.h"
 #include "IKChainManager_c.h"
 #include "FireManager.h"
 #include "CarCtrl.h"
@@ -60,10 +62,10 @@ void CWorld::InjectHooks() {
     RH_ScopedInstall(ProcessForAnimViewer, 0x5633D0);
     RH_ScopedInstall(ProcessPedsAfterPreRender, 0x563430);
     RH_ScopedInstall(ProcessAttachedEntities, 0x5647F0);
-    RH_ScopedInstall(TriggerExplosion, 0x56B790);
+    RH_ScopedInstall(TriggerExplosion, 0x56B790, {.locked = true}); // Locked because of `ms_PhysicalSleep.WakeInSphere`
     RH_ScopedInstall(ClearExcitingStuffFromArea, 0x56A0D0);
     RH_ScopedInstall(TestSphereAgainstWorld, 0x569E20);
-    RH_ScopedInstall(RepositionOneObject, 0x569850);
+    RH_ScopedInstall(RepositionOneObject, 0x569850, {.locked = true}); // Locked because of `ms_SpatialIndex.MarkDirty`
     RH_ScopedInstall(FindUnsuspectingTargetPed, 0x566DA0);
     RH_ScopedInstall(FindUnsuspectingTargetCar, 0x566C90);
     RH_ScopedInstall(FindLowestZForCoord, 0x5697F0);
@@ -170,6 +172,7 @@ void CWorld::Add(CEntity* entity) {
 // Remove entity from the world
 // 0x563280
 void CWorld::Remove(CEntity* entity) {
+    notsa::ContactCache::Remove(*entity); // NOTSA
     entity->Remove();
     if (entity->GetIsTypePhysical()) {
         entity->AsPhysical()->RemoveFromMovingList();
@@ -422,6 +425,7 @@ void CWorld::RemoveStaticObjects() {
             sector.Dummies.Flush();
         }
     }
+    ms_SpatialIndex.MarkAllDirty(); // NOTSA: The lists were flushed
 
     for (auto y = 0; y < (int32)(MAX_REPEAT_SECTORS_Y); y++) {
         for (auto x = 0; x < (int32)(MAX_REPEAT_SECTORS_X); x++) {
@@ -741,9 +745,12 @@ void CWorld::ShutDown() {
         IterateRepeatSectorsLists(MakeSureListIsEmpty);
         IterateSectorsLists(MakeSureListIsEmpty);
     }
+    ms_SpatialIndex.MarkAllDirty(); // NOTSA: The lists might've been flushed
 
     ms_listMovingEntityPtrs.Flush();
     ms_listObjectsWithControlCode.Flush();
+    ms_PhysicalSleep.Clear(); // NOTSA
+    ms_NeighbourGrid.Clear(); // NOTSA
 
     for (auto& player : Players) {
         player.m_PlayerData.DeAllocateData();
@@ -776,6 +783,9 @@ void CWorld::ClearForRestart() {
         }
     }
 
+    ms_PhysicalSleep.Clear(); // NOTSA
+    ms_NeighbourGrid.Clear(); // NOTSA
+
     CPickups::ReInit();
     CPools::CheckPoolsEmpty();
 }
@@ -892,6 +902,11 @@ bool CWorld::GetIsLineOfSightSectorListClear(PtrListType& ptrList, const CColLin
 
 // 0x564A20
 void CWorld::FindObjectsInRange(const CVector& point, float radius, bool b2D, int16* outCount, int16 maxCount, CEntity** outEntities, bool buildings, bool vehicles, bool peds, bool objects, bool dummies) {
+    if (ms_SpatialIndex.IsRecording()) { // NOTSA
+        ms_SpatialIndex.Record({ .Type = notsa::WorldSpatialIndex::QueryType::IN_RANGE, .A = point, .Radius = radius, .Is2D = b2D, .MaxCount = maxCount, .Buildings = buildings, .Vehicles = vehicles, .Peds = peds, .Objects = objects, .Dummies = dummies });
+    }
+    const auto useIndex = ms_SpatialIndex.IsEnabled(); // NOTSA
+
     AdvanceCurrentScanCode();
     *outCount = 0;
     IterateSectorsOverlappedByRect(
@@ -900,12 +915,19 @@ void CWorld::FindObjectsInRange(const CVector& point, float radius, bool b2D, in
             const auto ProcessSector = [&]<typename PtrListType>(PtrListType& list) {
                 FindObjectsInRangeSectorList(list, point, radius, b2D, outCount, maxCount, outEntities);
             };
+            const auto ProcessStaticSector = [&]<typename PtrListType>(PtrListType& list, notsa::WorldSpatialIndex::ListType type) {
+                if (useIndex) { // NOTSA
+                    ms_SpatialIndex.FindObjectsInRange(type, x, y, point, radius, b2D, outCount, maxCount, outEntities);
+                } else {
+                    ProcessSector(list);
+                }
+            };
 
             auto& sector = GetSector(x, y);
             auto& repeatSector = GetRepeatSector(x, y);
 
             if (buildings) {
-                ProcessSector(sector.Buildings);
+                ProcessStaticSector(sector.Buildings, notsa::WorldSpatialIndex::ListType::BUILDINGS);
             }
             if (vehicles) {
                 ProcessSector(repeatSector.Vehicles);
@@ -917,7 +939,7 @@ void CWorld::FindObjectsInRange(const CVector& point, float radius, bool b2D, in
                 ProcessSector(repeatSector.Objects);
             }
             if (dummies) {
-                ProcessSector(sector.Dummies);
+                ProcessStaticSector(sector.Dummies, notsa::WorldSpatialIndex::ListType::DUMMIES);
             }
 
             return true;
@@ -2201,6 +2223,13 @@ void CWorld::Process() {
         }
     });
 
+#ifdef NOTSA_DEBUG
+    // NOTSA: Find the nearest entities of all peds for their scanners, before any of them moves (See `CEntityScanner::ScanForEntitiesInRange`)
+    if (g_WorldConfig.SharedScanner) {
+        ms_NeighbourGrid.Update();
+    }
+#endif
+
     // Process moving entities (And possibly remove them from the world)
     {
         ZoneScopedN("Process moving entities");
@@ -2249,6 +2278,12 @@ void CWorld::Process() {
             entity->UpdateRwFrame();
         });
     } else {
+        // NOTSA: Measurement only (The collision below is still processed serially), see `notsa::CollisionIslands`
+        if (g_WorldConfig.CollisionIslands) {
+            ms_CollisionIslands.Build();
+        }
+        notsa::ContactCache::Update(); // NOTSA
+
         // Process collision
         {
             ZoneScopedN("Process collision");
@@ -2330,6 +2365,9 @@ void CWorld::Process() {
                 }
             });
         }
+
+        // NOTSA: Put the entities that have been resting for a while to sleep (And wake up the disturbed ones)
+        ms_PhysicalSleep.Update();
     }
     g_LoadMonitor.EndTimer(eLoadType::COLLISION);
 
@@ -2381,6 +2419,11 @@ bool CWorld::GetIsLineOfSightSectorClear(CSector& sector, CRepeatSector& repeatS
 
 // 0x568B80
 void CWorld::FindObjectsKindaColliding(const CVector& point, float radius, bool b2D, int16* outCount, int16 maxCount, CEntity** outEntities, bool buildings, bool vehicles, bool peds, bool objects, bool dummies) {
+    if (ms_SpatialIndex.IsRecording()) { // NOTSA
+        ms_SpatialIndex.Record({ .Type = notsa::WorldSpatialIndex::QueryType::KINDA_COLLIDING, .A = point, .Radius = radius, .Is2D = b2D, .MaxCount = maxCount, .Buildings = buildings, .Vehicles = vehicles, .Peds = peds, .Objects = objects, .Dummies = dummies });
+    }
+    const auto useIndex = ms_SpatialIndex.IsEnabled(); // NOTSA
+
     AdvanceCurrentScanCode();
     *outCount = 0;
     IterateSectorsOverlappedByRect(
@@ -2389,12 +2432,19 @@ void CWorld::FindObjectsKindaColliding(const CVector& point, float radius, bool
             const auto ProcessSector = [&]<typename PtrListType>(PtrListType& list) {
                 FindObjectsKindaCollidingSectorList(list, point, radius, b2D, outCount, maxCount, outEntities);
             };
+            const auto ProcessStaticSector = [&]<typename PtrListType>(PtrListType& list, notsa::WorldSpatialIndex::ListType type) {
+                if (useIndex) { // NOTSA
+                    ms_SpatialIndex.FindObjectsKindaColliding(type, x, y, point, radius, b2D, outCount, maxCount, outEntities);
+                } else {
+                    ProcessSector(list);
+                }
+            };
 
             auto& sector = GetSector(x, y);
             auto& repeatSector = GetRepeatSector(x, y);
 
             if (buildings) {
-                ProcessSector(sector.Buildings);
+                ProcessStaticSector(sector.Buildings, notsa::WorldSpatialIndex::ListType::BUILDINGS);
             }
             if (vehicles) {
                 ProcessSector(repeatSector.Vehicles);
@@ -2406,7 +2456,7 @@ void CWorld::FindObjectsKindaColliding(const CVector& point, float radius, bool
                 ProcessSector(repeatSector.Objects);
             }
             if (dummies) {
-                ProcessSector(sector.Dummies);
+                ProcessStaticSector(sector.Dummies, notsa::WorldSpatialIndex::ListType::DUMMIES);
             }
 
             return true;
@@ -2421,6 +2471,11 @@ void CWorld::FindObjectsIntersectingCube(const CVector& cornerA, const CVector&
     const int32 endSectorX = GetSectorX(cornerB.x);
     const int32 endSectorY = GetSectorY(cornerB.y);
 
+    if (ms_SpatialIndex.IsRecording()) { // NOTSA
+        ms_SpatialIndex.Record({ .Type = notsa::WorldSpatialIndex::QueryType::INTERSECTING_CUBE, .A = cornerA, .B = cornerB, .MaxCount = maxCount, .Buildings = buildings, .Vehicles = vehicles, .Peds = peds, .Objects = objects, .Dummies = dummies });
+    }
+    const auto useIndex = ms_SpatialIndex.IsEnabled(); // NOTSA
+
     AdvanceCurrentScanCode();
 
     *outCount = 0;
@@ -2429,6 +2484,13 @@ void CWorld::FindObjectsIntersectingCube(const CVector& cornerA, const CVector&
             const auto ProcessSector = [&]<typename PtrListType>(PtrListType& list) {
                 FindObjectsIntersectingCubeSectorList(list, cornerA, cornerB, outCount, maxCount, outEntities);
             };
+            const auto ProcessStaticSector = [&]<typename PtrListType>(PtrListType& list, notsa::WorldSpatialIndex::ListType type) {
+                if (useIndex) { // NOTSA
+                    ms_SpatialIndex.FindObjectsIntersectingCube(type, sectorX, sectorY, cornerA, cornerB, outCount, maxCount, outEntities);
+                } else {
+                    ProcessSector(list);
+                }
+            };
 
             auto& sector = GetSector(sectorX, sectorY);
             auto& repeatSector = GetRepeatSector(sectorX, sectorY);
@@ -2437,7 +2499,7 @@ void CWorld::FindObjectsIntersectingCube(const CVector& cornerA, const CVector&
             //       Reason being that once `outEntities` is filled up there's no
             //       no need to keep scanning for entities.
             if (buildings) {
-                ProcessSector(sector.Buildings);
+                ProcessStaticSector(sector.Buildings, notsa::WorldSpatialIndex::ListType::BUILDINGS);
             }
             if (vehicles) {
                 ProcessSector(repeatSector.Vehicles);
@@ -2449,7 +2511,7 @@ void CWorld::FindObjectsIntersectingCube(const CVector& cornerA, const CVector&
                 ProcessSector(repeatSector.Objects);
             }
             if (dummies) {
-                ProcessSector(sector.Dummies);
+                ProcessStaticSector(sector.Dummies, notsa::WorldSpatialIndex::ListType::DUMMIES);
             }
         }
     }
@@ -2652,6 +2714,7 @@ void CWorld::RepositionOneObject(CEntity* object) {
         pos.z = FindGroundZFor3DCoord({ point.x, point.y, pos.z + std::max(2.f, colModel->m_boundBox.GetHeight()) }, nullptr, nullptr) - colModel->m_boundBox.m_vecMin.z;
         object->UpdateRwMatrix();
         object->UpdateRwFrame();
+        ms_SpatialIndex.MarkDirty(object->GetBoundRect()); // NOTSA: Moved without being removed and re-added (So the index has the old position)
     };
 
     if (modelInfo->SwaysInWind() || IsObjectModelAnyOf({
@@ -2724,6 +2787,7 @@ void CWorld::RepositionOneObject(CEntity* object) {
         auto& pos = object->GetPosition();
         auto height = colModel->GetBoundingBox().GetHeight();
         pos.z = 6.f - height / 2.f + height / 5.f;
+        ms_SpatialIndex.MarkDirty(object->GetBoundRect()); // NOTSA
     }
 }
 
@@ -3060,6 +3124,9 @@ void CWorld::TriggerExplosion(const CVector& point, float radius, float visibleD
     const int32 endSectorX = GetSectorX(point.x + radius);
     const int32 endSectorY = GetSectorY(point.y + radius);
 
+    // NOTSA: Sleeping entities were moving, so they're woken up to react as such (Instead of as static objects, which need a stronger explosion)
+    ms_PhysicalSleep.WakeInSphere(point, radius);
+
     AdvanceCurrentScanCode();
 
     for (int32 sectorY = startSectorY; sectorY <= endSectorY; ++sectorY) {
@@ -3087,10 +3154,8 @@ void CWorld::SetWorldOnFire(CVector pos, float radius, CEntity* fireCreator) {
 
 // 0x56B9C0
 void CWorld::RepositionCertainDynamicObjects() {
-    for (int32 i = GetDummyPool()->GetSize(); i; i--) {
-        if (CDummy* dummy = GetDummyPool()->GetAt(i - 1)) {
-            RepositionOneObject(dummy);
-        }
+    for (auto& dummy : GetDummyPool()->GetAllValid()) { // NOTSA: Originally iterated backwards, but the order doesn't matter here
+        RepositionOneObject(&dummy);
     }
 }
 
@@ -10,6 +10,10 @@
 #include "PtrListDoubleLink.h"
 #include "PtrNodeDoubleLink.h"
 #include "Sector.h"
+#include "WorldSpatialIndex.h"
+#include "CollisionIslands.h"
+#include "PhysicalSleep.h"
+#include "NeighbourGrid.h"
 
 
 class CPedGroup;
@@ -83,6 +87,18 @@ public:
 
     inline static auto& m_aTempColPts = StaticRef<std::array<CColPoint, 32>>(0xB9ACD0);
 
+    //! NOTSA: Copy of the static sector lists for the range queries (See `FindObjectsInRange`, etc)
+    inline static notsa::WorldSpatialIndex ms_SpatialIndex{};
+
+    //! NOTSA: Islands of the moving entities that may collide with each other, built every frame before their collision is processed (See `Process`)
+    inline static notsa::CollisionIslands ms_CollisionIslands{};
+
+    //! NOTSA: Puts the moving entities that have been resting for a while to sleep, updated every frame after their collision is processed (See `Process`)
+    inline static notsa::PhysicalSleep ms_PhysicalSleep{};
+
+    //! NOTSA: Nearest vehicles and peds of every ped, built on the first entity scan of every frame (See `CEntityScanner::ScanForEntitiesInRange`)
+    inline static notsa::NeighbourGrid ms_NeighbourGrid{};
+
     static void ResetLineTestOptions();
 
     static void Initialise();
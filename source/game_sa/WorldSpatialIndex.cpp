@@ -0,0 +1,273 @@
+#include "StdInc.h"
+
+#include "WorldSpatialIndex.h"
+
+#include "extensions/Configs/World.hpp"
+
+#include <bit>
+#include <chrono>
+#include <xmmintrin.h>
+
+namespace notsa {
+WorldSpatialIndex::WorldSpatialIndex() :
+    m_Sectors(MAX_SECTORS)
+{
+}
+
+template<typename Test>
+void WorldSpatialIndex::Find(const List& list, Test&& test, bool stopIfFull, int16* outCount, int16 maxCount, CEntity** outEntities) {
+    const auto num = (uint32)list.Entities.size();
+
+    m_Stats.NumQueries++;
+    m_Stats.NumTested += num;
+
+    for (auto i = 0u; i < num; i += 8) {
+        // 8 at a time (2 SSE vectors), the padding at the end is masked out
+        auto mask = (uint32)_mm_movemask_ps(test(i)) | (uint32)_mm_movemask_ps(test(i + 4)) << 4;
+        if (num - i < 8) {
+            mask &= (1u << (num - i)) - 1;
+        }
+        for (; mask; mask &= mask - 1) {
+            if (stopIfFull && *outCount >= maxCount) {
+                return;
+            }
+
+            auto* const entity = list.Entities[i + std::countr_zero(mask)];
+            m_Stats.NumMatched++;
+
+            if (entity->IsScanCodeCurrent()) {
+                continue;
+            }
+            entity->SetCurrentScanCode();
+
+            if (*outCount < maxCount) {
+                if (outEntities) {
+                    outEntities[*outCount] = entity;
+                }
+                ++*outCount;
+            }
+        }
+    }
+}
+
+bool WorldSpatialIndex::IsEnabled() const {
+    return m_ForceEnabled.value_or(g_WorldConfig.SpatialIndex);
+}
+
+void WorldSpatialIndex::MarkDirty(int32 x, int32 y) {
+    for (auto& list : m_Sectors[std::clamp(y, 0, MAX_SECTORS_Y - 1) * MAX_SECTORS_X + std::clamp(x, 0, MAX_SECTORS_X - 1)]) {
+        list.IsDirty = true;
+    }
+}
+
+void WorldSpatialIndex::MarkDirty(const CRect& rect) {
+    // Clamped, as the rect might be huge (Same as in `CEntity::Remove`)
+    CWorld::IterateSectors(
+        std::clamp(CWorld::GetSectorX(rect.left), 0, MAX_SECTORS_X - 1),
+        std::clamp(CWorld::GetSectorY(rect.bottom), 0, MAX_SECTORS_Y - 1),
+        std::clamp(CWorld::GetSectorX(rect.right), 0, MAX_SECTORS_X - 1),
+        std::clamp(CWorld::GetSectorY(rect.top), 0, MAX_SECTORS_Y - 1),
+        [this](int32 x, int32 y) {
+            MarkDirty(x, y);
+            return true;
+        }
+    );
+}
+
+void WorldSpatialIndex::MarkAllDirty() {
+    for (auto& lists : m_Sectors) {
+        for (auto& list : lists) {
+            list.IsDirty = true;
+        }
+    }
+}
+
+void WorldSpatialIndex::FindObjectsInRange(ListType type, int32 x, int32 y, const CVector& point, float radius, bool b2D, int16* outCount, int16 maxCount, CEntity** outEntities) {
+    const auto& list = GetList(type, x, y);
+    const auto *xs = list.Get(List::POS_X), *ys = list.Get(List::POS_Y), *zs = list.Get(List::POS_Z);
+
+    const auto px = _mm_set1_ps(point.x), py = _mm_set1_ps(point.y), pz = _mm_set1_ps(point.z);
+    const auto radiusSq = _mm_set1_ps(radius * radius);
+    Find(list, [&](uint32 i) {
+        const auto dx = _mm_sub_ps(_mm_loadu_ps(xs + i), px);
+        const auto dy = _mm_sub_ps(_mm_loadu_ps(ys + i), py);
+        auto distSq = _mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy));
+        if (!b2D) {
+            const auto dz = _mm_sub_ps(_mm_loadu_ps(zs + i), pz);
+            distSq = _mm_add_ps(distSq, _mm_mul_ps(dz, dz));
+        }
+        return _mm_cmpngt_ps(distSq, radiusSq); // Not `<=`, so that it's the exact inverse of vanilla's `>` (Even for NaN's)
+    }, false, outCount, maxCount, outEntities);
+}
+
+void WorldSpatialIndex::FindObjectsKindaColliding(ListType type, int32 x, int32 y, const CVector& point, float radius, bool b2D, int16* outCount, int16 maxCount, CEntity** outEntities) {
+    const auto& list = GetList(type, x, y);
+    const auto *xs = list.Get(List::CENTRE_X), *ys = list.Get(List::CENTRE_Y), *zs = list.Get(List::CENTRE_Z), *rs = list.Get(List::RADIUS);
+
+    const auto px = _mm_set1_ps(point.x), py = _mm_set1_ps(point.y), pz = _mm_set1_ps(point.z);
+    const auto r = _mm_set1_ps(radius);
+    Find(list, [&](uint32 i) {
+        const auto dx = _mm_sub_ps(_mm_loadu_ps(xs + i), px);
+        const auto dy = _mm_sub_ps(_mm_loadu_ps(ys + i), py);
+        auto distSq = _mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy));
+        if (!b2D) {
+            const auto dz = _mm_sub_ps(_mm_loadu_ps(zs + i), pz);
+            distSq = _mm_add_ps(distSq, _mm_mul_ps(dz, dz));
+        }
+        // The distance isn't squared in vanilla, and `sqrt` is correctly rounded, so this gives the exact same results
+        return _mm_cmpnge_ps(_mm_sqrt_ps(distSq), _mm_add_ps(_mm_loadu_ps(rs + i), r));
+    }, true, outCount, maxCount, outEntities);
+}
+
+void WorldSpatialIndex::FindObjectsIntersectingCube(ListType type, int32 x, int32 y, const CVector& min, const CVector& max, int16* outCount, int16 maxCount, CEntity** outEntities) {
+    const auto& list = GetList(type, x, y);
+    const auto *xs = list.Get(List::POS_X), *ys = list.Get(List::POS_Y), *zs = list.Get(List::POS_Z), *rs = list.Get(List::RADIUS);
+
+    const auto minX = _mm_set1_ps(min.x), minY = _mm_set1_ps(min.y), minZ = _mm_set1_ps(min.z);
+    const auto maxX = _mm_set1_ps(max.x), maxY = _mm_set1_ps(max.y), maxZ = _mm_set1_ps(max.z);
+    Find(list, [&](uint32 i) {
+        const auto r = _mm_loadu_ps(rs + i);
+        const auto IsOverlapping = [&](const float* ps, __m128 lo, __m128 hi) {
+            const auto p = _mm_loadu_ps(ps + i);
+            return _mm_and_ps(_mm_cmpge_ps(_mm_add_ps(p, r), lo), _mm_cmple_ps(_mm_sub_ps(p, r), hi));
+        };
+        return _mm_and_ps(IsOverlapping(xs, minX, maxX), _mm_and_ps(IsOverlapping(ys, minY, maxY), IsOverlapping(zs, minZ, maxZ)));
+    }, false, outCount, maxCount, outEntities);
+}
+
+void WorldSpatialIndex::StartRecording(uint32 maxQueries) {
+    m_Recording.clear();
+    m_Recording.reserve(maxQueries);
+    m_MaxRecordedQueries = maxQueries;
+    m_IsRecording        = true;
+}
+
+void WorldSpatialIndex::Record(const RecordedQuery& query) {
+    m_Recording.push_back(query);
+    if (m_Recording.size() >= m_MaxRecordedQueries) {
+        m_IsRecording = false;
+    }
+}
+
+WorldSpatialIndex::BenchmarkResult WorldSpatialIndex::RunBenchmark(uint32 numRepeats) {
+    ZoneScoped;
+
+    using namespace std::chrono;
+
+    // Replaying mustn't record, nor show up in the stats
+    const auto wasRecording = std::exchange(m_IsRecording, false);
+    const auto stats        = m_Stats;
+    const notsa::ScopeGuard restore{ [&] {
+        m_IsRecording  = wasRecording;
+        m_ForceEnabled = std::nullopt;
+        m_Stats        = stats;
+    } };
+
+    int32 maxCount{};
+    for (const auto& q : m_Recording) {
+        maxCount = std::max<int32>(maxCount, q.MaxCount);
+    }
+    std::vector<CEntity*> vanillaEntities(maxCount), indexEntities(maxCount);
+
+    const auto Replay = [](const RecordedQuery& q, CEntity** outEntities) {
+        int16 count{};
+        switch (q.Type) {
+        case QueryType::IN_RANGE:
+            CWorld::FindObjectsInRange(q.A, q.Radius, q.Is2D, &count, q.MaxCount, outEntities, q.Buildings, q.Vehicles, q.Peds, q.Objects, q.Dummies);
+            break;
+        case QueryType::KINDA_COLLIDING:
+            CWorld::FindObjectsKindaColliding(q.A, q.Radius, q.Is2D, &count, q.MaxCount, outEntities, q.Buildings, q.Vehicles, q.Peds, q.Objects, q.Dummies);
+            break;
+        case QueryType::INTERSECTING_CUBE:
+            CWorld::FindObjectsIntersectingCube(q.A, q.B, &count, q.MaxCount, outEntities, q.Buildings, q.Vehicles, q.Peds, q.Objects, q.Dummies);
+            break;
+        default:
+            NOTSA_UNREACHABLE();
+        }
+        return count;
+    };
+
+    BenchmarkResult result{ .NumQueries = (uint32)m_Recording.size(), .NumRepeats = numRepeats };
+
+    // Compare the results first (This also rebuilds the dirty lists, so that isn't measured)
+    for (const auto& q : m_Recording) {
+        m_ForceEnabled = false;
+        const auto vanillaCount = Replay(q, vanillaEntities.data());
+        m_ForceEnabled = true;
+        const auto indexCount = Replay(q, indexEntities.data());
+        if (vanillaCount != indexCount || !std::equal(vanillaEntities.begin(), vanillaEntities.begin() + vanillaCount, indexEntities.begin())) {
+            result.NumMismatches++;
+        }
+    }
+
+    const auto Measure = [&](bool useIndex) {
+        m_ForceEnabled = useIndex;
+        const auto begin = high_resolution_clock::now();
+        for (auto r = 0u; r < numRepeats; r++) {
+            for (const auto& q : m_Recording) {
+                Replay(q, vanillaEntities.data());
+            }
+        }
+        return duration<double, std::milli>(high_resolution_clock::now() - begin).count();
+    };
+    result.VanillaMs = Measure(false);
+    result.IndexMs   = Measure(true);
+
+    return result;
+}
+
+const WorldSpatialIndex::List& WorldSpatialIndex::GetList(ListType type, int32 x, int32 y) {
+    // Same clamping as `CWorld::GetSector`
+    x = std::clamp(x, 0, MAX_SECTORS_X - 1);
+    y = std::clamp(y, 0, MAX_SECTORS_Y - 1);
+
+    auto& list = m_Sectors[y * MAX_SECTORS_X + x][(size_t)type];
+    if (list.IsDirty) {
+        Rebuild(list, type, x, y);
+    }
+    return list;
+}
+
+void WorldSpatialIndex::Rebuild(List& list, ListType type, int32 x, int32 y) {
+    ZoneScoped;
+
+    const auto CopyList = [&]<typename PtrListType>(PtrListType& ptrList) {
+        list.Entities.clear();
+        for (auto* const entity : ptrList) {
+            list.Entities.push_back(entity);
+        }
+    };
+    auto& sector = CWorld::GetSector(x, y);
+    switch (type) {
+    case ListType::BUILDINGS: CopyList(sector.Buildings); break;
+    case ListType::DUMMIES:   CopyList(sector.Dummies); break;
+    default:                  NOTSA_UNREACHABLE();
+    }
+
+    // Padding is zero, it's masked out in `Find`
+    const auto numPadded = list.GetNumPadded();
+    list.Data.assign(List::NUM_FIELDS * numPadded, 0.f);
+    const auto Set = [&](List::Field field, uint32 i, float value) {
+        list.Data[field * numPadded + i] = value;
+    };
+    for (auto i = 0u; i < list.Entities.size(); i++) {
+        const auto* const entity = list.Entities[i];
+        const auto* const cm     = entity->GetColModel();
+
+        // Entities without a col model (Shouldn't happen) never collide or intersect [Vanilla would crash]
+        const auto& pos    = entity->GetPosition();
+        const auto  centre = cm ? entity->GetBoundCentre() : pos;
+
+        Set(List::POS_X, i, pos.x);
+        Set(List::POS_Y, i, pos.y);
+        Set(List::POS_Z, i, pos.z);
+        Set(List::CENTRE_X, i, centre.x);
+        Set(List::CENTRE_Y, i, centre.y);
+        Set(List::CENTRE_Z, i, centre.z);
+        Set(List::RADIUS, i, cm ? cm->GetBoundRadius() : -FLT_MAX);
+    }
+
+    list.IsDirty = false;
+    m_Stats.NumRebuilds++;
+}
+}; // namespace notsa
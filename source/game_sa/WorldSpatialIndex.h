@@ -0,0 +1,146 @@
+#pragma once
+
+#include <array>
+#include <optional>
+#include <span>
+#include <vector>
+
+#include "Vector.h"
+
+class CEntity;
+class CRect;
+
+namespace notsa {
+/*!
+ * @brief NOTSA: Structure-of-arrays copy of the static (Building and dummy) sector lists, used by `CWorld`'s range queries.
+ *
+ * The sector lists are linked lists of entity pointers, so every entity tested by a query (`CWorld::FindObjectsInRange`, etc)
+ * costs a node and an entity (Plus its matrix, model info and col model) that are most likely not in the cache.
+ * Here each list has the positions, bounding spheres and pointers of its entities packed into arrays (In the same order as the list),
+ * so they're tested 8 at a time with SSE, and only the entities that pass the test are dereferenced (To check their scan code).
+ *
+ * Only the static lists are mirrored: Vehicles, peds and objects move every frame, keeping a copy of their positions
+ * up-to-date would cost more than what the queries would save - Those are still tested by walking the list.
+ * A list's copy is rebuilt by the first query after the list (or one of its entities) changed, see `MarkDirty`.
+ */
+class WorldSpatialIndex {
+public:
+    enum class ListType : uint8 {
+        BUILDINGS, //!< `CSector::Buildings`
+        DUMMIES,   //!< `CSector::Dummies`
+
+        NUM
+    };
+
+    enum class QueryType : uint8 {
+        IN_RANGE,           //!< `CWorld::FindObjectsInRange`
+        KINDA_COLLIDING,    //!< `CWorld::FindObjectsKindaColliding`
+        INTERSECTING_CUBE,  //!< `CWorld::FindObjectsIntersectingCube`
+    };
+
+    //! Arguments of a query, see `StartRecording`
+    struct RecordedQuery {
+        QueryType Type{};
+        CVector   A{};        //!< Point or the min. corner of the cube
+        CVector   B{};        //!< Max. corner of the cube
+        float     Radius{};
+        bool      Is2D{};
+        int16     MaxCount{};
+        bool      Buildings{}, Vehicles{}, Peds{}, Objects{}, Dummies{};
+    };
+
+    struct BenchmarkResult {
+        uint32 NumQueries{};
+        uint32 NumRepeats{};
+        uint32 NumMismatches{}; //!< Number of queries whose results differed between the 2 implementations
+        double VanillaMs{};     //!< Time it took to replay all queries `NumRepeats` times by walking the sector lists
+        double IndexMs{};       //!< Same, but using the index
+    };
+
+    struct Stats {
+        uint64 NumQueries{};  //!< Number of lists queried
+        uint64 NumTested{};   //!< Number of entities tested
+        uint64 NumMatched{};  //!< Number of entities that passed the test (So they had to be dereferenced)
+        uint64 NumRebuilds{}; //!< Number of lists rebuilt
+    };
+
+public:
+    WorldSpatialIndex();
+
+    //! Whenever `CWorld` should use the index
+    bool IsEnabled() const;
+
+    //! The lists of the sector changed
+    //! The hooks of the functions calling this must be locked, otherwise the index would keep stale entities (See `CEntity::Add/Remove`, `CBuilding::ReplaceWithNewModel`)
+    void MarkDirty(int32 x, int32 y);
+
+    //! The lists of the sectors overlapped by the rect changed (Or an entity in them was modified, eg.: it's model changed)
+    //! Must also be called when a static entity is moved without being removed and re-added (Eg.: `CWorld::RepositionOneObject`)
+    void MarkDirty(const CRect& rect);
+
+    //! Everything changed
+    void MarkAllDirty();
+
+    //! Same as `CWorld::FindObjectsInRangeSectorList` (Except that the scan code is only set for entities that are in range)
+    void FindObjectsInRange(ListType list, int32 x, int32 y, const CVector& point, float radius, bool b2D, int16* outCount, int16 maxCount, CEntity** outEntities);
+
+    //! Same as `CWorld::FindObjectsKindaCollidingSectorList` (Except that the scan code is only set for entities that are colliding)
+    void FindObjectsKindaColliding(ListType list, int32 x, int32 y, const CVector& point, float radius, bool b2D, int16* outCount, int16 maxCount, CEntity** outEntities);
+
+    //! Same as `CWorld::FindObjectsIntersectingCubeSectorList` (Except that the scan code is only set for entities that are intersecting)
+    void FindObjectsIntersectingCube(ListType list, int32 x, int32 y, const CVector& min, const CVector& max, int16* outCount, int16 maxCount, CEntity** outEntities);
+
+    //! Start recording the queries `CWorld` makes (Up to `maxQueries`), for `RunBenchmark`
+    void StartRecording(uint32 maxQueries);
+    void StopRecording() { m_IsRecording = false; }
+    bool IsRecording() const { return m_IsRecording; }
+    void Record(const RecordedQuery& query);
+    std::span<const RecordedQuery> GetRecording() const { return m_Recording; }
+
+    //! Replay the recorded queries `numRepeats` times with and without the index, and compare their results
+    BenchmarkResult RunBenchmark(uint32 numRepeats);
+
+    const Stats& GetStats() const { return m_Stats; }
+    void ResetStats() { m_Stats = {}; }
+
+private:
+    //! Copy of a sector list. `Data` has a `GetNumPadded()` long array for each `Field`
+    struct List {
+        enum Field {
+            POS_X, POS_Y, POS_Z,          //!< `CEntity::GetPosition()`
+            CENTRE_X, CENTRE_Y, CENTRE_Z, //!< `CEntity::GetBoundCentre()`
+            RADIUS,                       //!< Bound radius of the col model
+
+            NUM_FIELDS
+        };
+
+        std::vector<float>    Data{};
+        std::vector<CEntity*> Entities{};
+        bool                  IsDirty{ true };
+
+        uint32       GetNumPadded() const { return (uint32)(Entities.size() + 7) & ~7u; }
+        const float* Get(Field f) const { return Data.data() + f * GetNumPadded(); }
+    };
+
+    const List& GetList(ListType type, int32 x, int32 y);
+    void        Rebuild(List& list, ListType type, int32 x, int32 y);
+
+    /*!
+     * @brief Add the entities of a list that pass a test to the output
+     * @param test        Called with the index of the first of 4 entities, returns the SSE mask of the ones that passed
+     * @param stopIfFull  Whenever to stop once `maxCount` entities were found (Otherwise the scan codes of the rest are still set)
+     */
+    template<typename Test>
+    void Find(const List& list, Test&& test, bool stopIfFull, int16* outCount, int16 maxCount, CEntity** outEntities);
+
+private:
+    std::vector<std::array<List, (size_t)ListType::NUM>> m_Sectors{}; //!< Indexed by `y * MAX_SECTORS_X + x`
+
+    std::vector<RecordedQuery> m_Recording{};
+    uint32                     m_MaxRecordedQueries{};
+    bool                       m_IsRecording{};
+    std::optional<bool>        m_ForceEnabled{}; //!< Overrides the config while the benchmark runs
+
+    Stats m_Stats{};
+};
+}; // namespace notsa
@@ -3,6 +3,7 @@
 #include "Base.h"
 #include "eScriptCommands.h"
 #include "RunningScript.h"
+#include "ScriptDecodeCache.h"
 
 #ifdef NOTSA_WITH_SCRIPT_COMMAND_HOOKS
 namespace ReversibleHooks {
@@ -26,6 +27,7 @@ struct ScriptCommand : Base {
 
         m_IsHooked = !m_IsHooked;
         CRunningScript::CustomCommandHandlerOf(m_cmd) = m_IsHooked ? m_originalHandler : nullptr;
+        DecodeCache::Invalidate(); // NOTSA: It may have the old handler
     }
 
     void        Check() override { /* nop */ }
@@ -2,6 +2,10 @@
 
 #include "CStreamingDebugModule.h"
 #include "Streaming.h"
+#include "CdStreamAsyncReader.h"
+#include "CdDirectoryIndex.h"
+
+#include "extensions/Configs/Streaming.hpp"
 
 using namespace ImGui;
 
@@ -85,6 +89,104 @@ void DrawListSizes() {
     Text("Loaded list size: %u", GetListSize(CStreaming::ms_startLoadedList, CStreaming::ms_pEndLoadedList));
 }
 
+void DrawAsyncReaderStats() {
+    if (!g_StreamingConfig.AsyncReader) {
+        Text("Async reader: Disabled");
+        return;
+    }
+    const auto& reader = CStreaming::GetAsyncReader();
+    const auto& stats  = reader.GetStats();
+    const auto  reqs   = stats.NumRequests.load();
+    const auto  reads  = stats.NumReads.load();
+    Text("Async reader: %u threads, %u pending", reader.GetNumThreads(), reader.GetNumPending());
+    Text("Requests: %llu, Reads: %llu (%.2f requests/read)", reqs, reads, reads ? (float)reqs / (float)reads : 0.f);
+    Text("Read: %llu KiB, Failures: %llu", stats.NumSectorsRead.load() * STREAMING_SECTOR_SIZE / 1024, stats.NumFailures.load());
+}
+
+void DrawDecodeStats() {
+    if (!BeginTable("Decode Throughput", 5, ImGuiTableFlags_SizingFixedFit | ImGuiTableFlags_Borders)) {
+        return;
+    }
+
+    TableSetupColumn("Type");
+    TableSetupColumn("Files");
+    TableSetupColumn("KiB");
+    TableSetupColumn("ms");
+    TableSetupColumn("KiB/ms");
+    TableHeadersRow();
+
+    const auto DrawRow = [](const char* type, const tStreamingDecodeStats& stats) {
+        TableNextRow();
+        TableNextColumn(); TextUnformatted(type);
+        TableNextColumn(); Text("%llu", stats.NumFiles.load());
+        TableNextColumn(); Text("%llu", stats.NumBytes.load() / 1024);
+        TableNextColumn(); Text("%.2f", (float)stats.NumMicroseconds.load() / 1000.f);
+        TableNextColumn(); Text("%.2f", stats.GetBytesPerMs() / 1024.f);
+    };
+    constexpr const char* TYPE_NAMES[]{ "DFF", "TXD", "COL", "IPL", "DAT", "IFP", "RRR", "SCM" };
+    static_assert(std::size(TYPE_NAMES) == std::size(CStreaming::ms_DecodeStats));
+    for (auto i = 0u; i < std::size(TYPE_NAMES); i++) {
+        DrawRow(TYPE_NAMES[i], CStreaming::ms_DecodeStats[i]);
+    }
+    DrawRow("COL (Reader threads)", CStreaming::ms_ColDecodeStatsOffThread);
+
+    EndTable();
+}
+
+void DrawSchedulerStats() {
+    auto&       scheduler = CStreaming::ms_Scheduler;
+    const auto& stats     = scheduler.GetStats();
+
+    Text("Scheduler: %s", g_StreamingConfig.Scheduler ? "Enabled" : "Disabled");
+    SameLine();
+    if (Button("Reset Stats")) {
+        scheduler.ResetStats();
+    }
+    Text("Queue depth: %i (Max: %u)", CStreaming::ms_numModelsRequested, stats.MaxQueueDepth);
+    Text("Latency: %.1f ms avg, %u ms max (%llu loaded)", stats.GetAvgLatencyMs(), stats.MaxLatencyMs, stats.NumLoaded);
+    Text("Missed deadlines: %llu (Deadline: %u ms)", stats.NumMissedDeadlines, g_StreamingConfig.SchedulerDeadlineMs);
+    Text("Picks: %llu, Reordered: %llu", stats.NumPicks, stats.NumReordered);
+}
+
+void DrawPrefetcherStats() {
+    auto&       prefetcher = CStreaming::ms_Prefetcher;
+    const auto& stats      = prefetcher.GetStats();
+
+    Text("Prefetch: %s", g_StreamingConfig.Prefetch ? "Enabled" : "Disabled");
+    SameLine();
+    if (Button("Reset Stats##Prefetch")) {
+        prefetcher.ResetStats();
+    }
+    Text("Look-ahead points: %u (%s)", (uint32)prefetcher.GetLookAheadPoints().size(), prefetcher.IsFollowingRoute() ? "Route" : "Velocity");
+    Text("Pending: %u", prefetcher.GetNumPending());
+    Text("Prefetched: %llu (%llu KiB)", stats.NumPrefetched, stats.NumPrefetchedBytes / 1024);
+    Text("Hits: %llu (%llu KiB), Hit rate: %.1f%%", stats.NumHits, stats.NumHitBytes / 1024, stats.GetHitRate() * 100.f);
+    Text("Wasted: %llu (%llu KiB)", stats.NumWasted, stats.NumWastedBytes / 1024);
+    Text("Cancelled: %llu (%llu KiB)", stats.NumCancelled, stats.NumCancelledBytes / 1024);
+}
+
+void DrawEvictorStats() {
+    auto&       evictor = CStreaming::ms_Evictor;
+    const auto& stats   = evictor.GetStats();
+
+    const auto policy = notsa::StreamingEvictor::GetPolicy();
+    SetNextItemWidth(200.f);
+    if (BeginCombo("Eviction policy", notsa::StreamingEvictor::GetPolicyName(policy))) {
+        for (auto i = 0u; i < (uint32)notsa::StreamingEvictionPolicy::NUM; i++) {
+            if (Selectable(notsa::StreamingEvictor::GetPolicyName((notsa::StreamingEvictionPolicy)i), i == (uint32)policy)) {
+                g_StreamingConfig.EvictionPolicy = i;
+            }
+        }
+        EndCombo();
+    }
+    SameLine();
+    if (Button("Reset Stats##Evictor")) {
+        evictor.ResetStats();
+    }
+    Text("Hits: %llu, Misses: %llu (Hit rate: %.1f%%)", stats.NumHits, stats.NumMisses, stats.GetHitRate() * 100.f);
+    Text("Evictions: %llu, Thrashes: %llu (Window: %u ms)", stats.NumEvictions, stats.NumThrashes, g_StreamingConfig.EvictionThrashWindowMs);
+}
+
 void CStreamingDebugModule::RenderWindow() {
     notsa::ui::ScopedWindow window{ "Streaming", {700, 200.f}, m_IsOpen };
     if (!m_IsOpen) {
@@ -102,6 +204,15 @@ void CStreamingDebugModule::RenderWindow() {
     DrawChannelStates();
 
     Text("Loading big model: %i", (int32)CStreaming::ms_bLoadingBigModel);
+
+    const auto& dirStats = notsa::CdDirectoryIndex::GetStats();
+    Text("Directories: %u read (%.1f ms)", dirStats.NumRead, dirStats.TotalTimeMs);
+
+    DrawSchedulerStats();
+    DrawPrefetcherStats();
+    DrawEvictorStats();
+    DrawAsyncReaderStats();
+    DrawDecodeStats();
 }
 
 void CStreamingDebugModule::RenderMenuEntry() {
@@ -8,6 +8,9 @@
 #include "Lines.h"
 #include "TaskSimpleClimb.h"
 #include "extensions/utility.hpp"
+#include "extensions/Configs/Collision.hpp"
+#include "ColTriangleBVH.h"
+#include "ContactCache.h"
 
 constexpr auto BB_COLOR       = 0xFF0000FF; // red
 constexpr auto BOX_COLOR      = 0xFFFFFFFF; // white
@@ -127,6 +130,63 @@ void CollisionDebugModule::RenderWindow() {
         RenderShapeShapeCollisionStuff();
         ImGui::TreePop();
     }
+
+    if (ImGui::TreeNode("Triangle BVH")) {
+        RenderTriangleBVHStats();
+        ImGui::TreePop();
+    }
+
+    if (ImGui::TreeNode("Contact Cache")) {
+        RenderContactCacheStats();
+        ImGui::TreePop();
+    }
+}
+
+void CollisionDebugModule::RenderTriangleBVHStats() {
+    const auto& stats = notsa::ColTriangleBVH::GetStats();
+
+    ImGui::Checkbox("Enabled", &g_CollisionConfig.TriangleBVH);
+    ImGui::SameLine();
+    if (ImGui::Button("Reset Stats")) {
+        notsa::ColTriangleBVH::ResetStats();
+    }
+
+    ImGui::Text("Col models: %u, Triangles: %u, Memory: %.1f KiB", stats.NumBVHs, stats.NumTris, (double)(stats.NumBytes) / 1024.0);
+    ImGui::Text(
+        "Queries: %llu, Triangles tested: %llu (%.2f per query)",
+        stats.NumQueries,
+        stats.NumTrisTested,
+        stats.NumQueries ? (double)(stats.NumTrisTested) / (double)(stats.NumQueries) : 0.0
+    );
+
+    ImGui::Checkbox("SIMD", &g_CollisionConfig.TriangleSIMD);
+    ImGui::SameLine();
+    ImGui::Checkbox("Validate SIMD", &g_CollisionConfig.ValidateTriangleSIMD);
+    ImGui::Text("Triangles culled by SIMD: %llu, Misses: %llu", stats.NumTrisCulled, stats.NumSIMDMisses);
+}
+
+void CollisionDebugModule::RenderContactCacheStats() {
+    const auto& stats = notsa::ContactCache::GetStats();
+
+    ImGui::Checkbox("Enabled", &g_CollisionConfig.ContactCache);
+    ImGui::SameLine();
+    if (ImGui::Button("Reset Stats")) {
+        notsa::ContactCache::ResetStats();
+    }
+
+    ImGui::SliderFloat("Max Move", &g_CollisionConfig.ContactCacheMaxMove, 0.f, 0.5f);
+    ImGui::SliderFloat("Max Turn", &g_CollisionConfig.ContactCacheMaxTurn, 0.f, 0.2f);
+    constexpr uint32 minFrames = 0, maxFrames = 60;
+    ImGui::SliderScalar("Max Frames", ImGuiDataType_U32, &g_CollisionConfig.ContactCacheMaxFrames, &minFrames, &maxFrames);
+
+    ImGui::Text("Entity pairs: %u", stats.NumEntries);
+    ImGui::Text(
+        "Queries: %llu, Reused: %llu (%.1f%%), Contacts dropped: %llu",
+        stats.NumQueries,
+        stats.NumReused,
+        stats.NumQueries ? 100.0 * (double)(stats.NumReused) / (double)(stats.NumQueries) : 0.0,
+        stats.NumDropped
+    );
 }
 
 void CollisionDebugModule::DrawColModel(const CMatrix& transform, const CColModel& cm) {
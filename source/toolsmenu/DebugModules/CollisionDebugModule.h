@@ -14,6 +14,8 @@ public:
 private:
     void DrawColModel(const CMatrix& matrix, const CColModel& cm);
     void RenderVisibleColModels();
+    void RenderTriangleBVHStats();
+    void RenderContactCacheStats();
 
 private:
     // Visualization
@@ -22,6 +22,7 @@
 #include "ParticleDebugModule.h"
 #include "PostEffectsDebugModule.h"
 #include "PoolsDebugModule.h"
+#include "WorldDebugModule.h"
 #include "TimeCycleDebugModule.h"
 #include "CullZonesDebugModule.h"
 #include "TextDebugModule.h"
@@ -105,6 +106,7 @@ void DebugModules::CreateModules() {
     // "Stats" menu
     Add<PoolsDebugModule>();
     Add<CStreamingDebugModule>();
+    Add<WorldDebugModule>();
 
     // "Extra" menu (Put your extra debug modules here, unless they might be useful in general)
     Add<DarkelDebugModule>();
@@ -10,6 +10,8 @@
 #include "TaskManager.h"
 #include "Hud.h"
 #include "Lines.h"
+#include "AnimLOD.h"
+#include "extensions/Configs/Animation.hpp"
 
 #include "Tasks/TaskTypes/TaskComplexWander.h"
 #include "Tasks/TaskTypes/TaskSimpleGoToPoint.h"
@@ -285,7 +287,8 @@ void PedDebugModule::RenderWindow() {
     // https://stackoverflow.com/a/60971856
     const auto to_vector = []<rng::range R>(R&& r) {
         using elem_t = std::decay_t<rng::range_value_t<R>>;
-        return std::vector<elem_t>{r.begin(), r.end()};
+        auto c = r | rngv::common; // The pools' ranges end with a sentinel
+        return std::vector<elem_t>{c.begin(), c.end()};
     };
 
     if (!GetPedPool()) return;
@@ -338,4 +341,12 @@ void PedDebugModule::RenderMenuEntry() {
         const notsa::ui::ScopedDisable disable2{ !m_AutoCollapseEnabled };
         SliderFloat("Distance", &m_CollapseToggleDist, 4.f, 300.f);
     });
+    notsa::ui::DoNestedMenuIL({ "Visualization", "Peds", "Animation LOD" }, [&] {
+        using notsa::AnimLOD;
+        Checkbox("Enabled", &g_AnimationConfig.AnimLOD);
+        const auto& stats = AnimLOD::GetStats();
+        Text("Full: %u", stats.NumPeds[(size_t)AnimLOD::Tier::FULL]);
+        Text("Reduced: %u", stats.NumPeds[(size_t)AnimLOD::Tier::REDUCED]);
+        Text("Low: %u (Skipped: %u)", stats.NumPeds[(size_t)AnimLOD::Tier::LOW], stats.NumSkipped);
+    });
 }
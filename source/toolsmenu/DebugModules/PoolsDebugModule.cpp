@@ -5,6 +5,10 @@
 #include "EntryExitManager.h"
 #include "StuntJumpManager.h"
 #include "CustomCarEnvMapPipeline.h"
+#include "Events/EventArena.h"
+#include "extensions/Configs/Pools.hpp"
+
+#include <chrono>
 
 void PoolsDebugModule::RenderWindow() {
     const notsa::ui::ScopedWindow window{ "Pools Stats", {446.f, 512.f}, m_IsOpen };
@@ -12,7 +16,7 @@ void PoolsDebugModule::RenderWindow() {
         return;
     }
 
-    if (!ImGui::BeginTable("PoolsDebugModule", 5, ImGuiTableFlags_SizingFixedFit | ImGuiTableFlags_Resizable | ImGuiTableFlags_BordersOuter | ImGuiTableFlags_BordersV | ImGuiTableFlags_ContextMenuInBody)) {
+    if (!ImGui::BeginTable("PoolsDebugModule", 8, ImGuiTableFlags_SizingFixedFit | ImGuiTableFlags_Resizable | ImGuiTableFlags_BordersOuter | ImGuiTableFlags_BordersV | ImGuiTableFlags_ContextMenuInBody)) {
         return;
     }
 
@@ -21,6 +25,9 @@ void PoolsDebugModule::RenderWindow() {
     ImGui::TableSetupColumn("Active objects");
     ImGui::TableSetupColumn("Usage (%)");
     ImGui::TableSetupColumn("DealWithNoMemory");
+    ImGui::TableSetupColumn("Free-list");
+    ImGui::TableSetupColumn("Occupancy Bitmap");
+    ImGui::TableSetupColumn("Growable");
     ImGui::TableHeadersRow();
 
     const auto Draw = [](auto* pool, const char* name) {
@@ -57,6 +64,15 @@ void PoolsDebugModule::RenderWindow() {
             ImGui::TableNextColumn();
             ImGui::Text(pool->CanDealWithNoMemory() ? "T" : "F");
 
+            ImGui::TableNextColumn();
+            ImGui::Text(pool->IsUsingFreeList() ? "T" : "F");
+
+            ImGui::TableNextColumn();
+            ImGui::Text(pool->IsTrackingOccupancy() ? "T" : "F");
+
+            ImGui::TableNextColumn();
+            ImGui::Text(pool->IsGrowable() ? "T" : "F");
+
             ImGui::PopID();
         }
     };
@@ -94,6 +110,116 @@ void PoolsDebugModule::RenderWindow() {
     Draw(CCustomCarEnvMapPipeline::m_gSpecMapPipeMatDataPool, "Spec Map Pipe: Material Data");
 
     ImGui::EndTable();
+
+    RenderEventStats();
+    RenderBenchmark();
+}
+
+void PoolsDebugModule::RenderEventStats() {
+    if (!ImGui::CollapsingHeader("Events")) {
+        return;
+    }
+
+    using notsa::EventArena;
+
+    const auto& stats = EventArena::GetStats();
+    ImGui::Checkbox("Allocate transient events from the arena", &g_PoolsConfig.TransientEventArena);
+    ImGui::Text("Last frame - Created: %u, Transient: %u, Cloned: %u, Dropped: %u", stats.NumCreated, stats.NumTransient, stats.NumCloned, stats.NumDropped);
+    ImGui::Text("Arena - Alive: %u, Capacity: %u KiB", (uint32)EventArena::GetNumAlive(), (uint32)(EventArena::GetCapacity() / 1024));
+}
+
+void PoolsDebugModule::RenderBenchmark() {
+    if (!ImGui::CollapsingHeader("Allocation Benchmark")) {
+        return;
+    }
+
+    if (ImGui::Button("Run")) {
+        using namespace std::chrono;
+
+        constexpr auto POOL_SIZE   = 16'384u;
+        constexpr auto NUM_CHURNS  = 100'000u;
+        constexpr auto CHURN_BATCH = 64u; // Objects deleted before re-allocating them
+
+        struct Object { byte data[64]; };
+
+        std::mt19937 rng{ 1337u };
+
+        const auto Measure = [](auto&& fn) {
+            const auto begin = high_resolution_clock::now();
+            fn();
+            return duration<double, std::milli>(high_resolution_clock::now() - begin).count();
+        };
+
+        m_BenchmarkResults.clear();
+        for (const auto occupancy : { 0.5f, 0.9f, 0.99f }) {
+            for (const auto useFreeList : { false, true }) {
+                CPool<Object> pool{ POOL_SIZE, "Benchmark" };
+                pool.SetUseFreeList(useFreeList);
+
+                std::vector<Object*> objs;
+                objs.reserve(POOL_SIZE);
+
+                BenchmarkResult r{ .Occupancy = occupancy, .UseFreeList = useFreeList };
+                r.FillMs = Measure([&] {
+                    while ((float)(objs.size()) < (float)(POOL_SIZE) * occupancy) {
+                        objs.push_back(pool.New());
+                    }
+                });
+                r.ChurnMs = Measure([&] {
+                    // Deleting and re-allocating one object at a time doesn't tell the modes apart, as `Delete` makes
+                    // the scan start at the slot just freed - So free a batch of random objects (spread across the pool) first
+                    for (auto i = 0u; i < NUM_CHURNS; i += CHURN_BATCH) {
+                        for (auto j = 0u; j < CHURN_BATCH; j++) { // Move random objects to the front (Partial shuffle)
+                            std::swap(objs[j], objs[std::uniform_int_distribution<size_t>{ j, objs.size() - 1 }(rng)]);
+                            pool.Delete(objs[j]);
+                        }
+                        for (auto j = 0u; j < CHURN_BATCH; j++) {
+                            objs[j] = pool.New();
+                        }
+                    }
+                });
+                std::shuffle(objs.begin(), objs.end(), rng);
+                r.DrainMs = Measure([&] {
+                    for (auto* const obj : objs) {
+                        pool.Delete(obj);
+                    }
+                });
+                m_BenchmarkResults.push_back(r);
+            }
+        }
+    }
+
+    if (m_BenchmarkResults.empty() || !ImGui::BeginTable("PoolsBenchmark", 5, ImGuiTableFlags_SizingFixedFit | ImGuiTableFlags_BordersOuter | ImGuiTableFlags_BordersV)) {
+        return;
+    }
+
+    ImGui::TableSetupColumn("Occupancy");
+    ImGui::TableSetupColumn("Mode");
+    ImGui::TableSetupColumn("Fill (ms)");
+    ImGui::TableSetupColumn("Churn (ms)");
+    ImGui::TableSetupColumn("Drain (ms)");
+    ImGui::TableHeadersRow();
+
+    for (const auto& r : m_BenchmarkResults) {
+        ImGui::TableNextRow();
+
+        ImGui::TableNextColumn();
+        ImGui::Text("%.0f %%", (double)(r.Occupancy) * 100.0);
+
+        ImGui::TableNextColumn();
+        ImGui::TextUnformatted(r.UseFreeList ? "Free-list" : "Scan");
+
+        ImGui::TableNextColumn();
+        ImGui::Text("%.3f", r.FillMs);
+
+        ImGui::TableNextColumn();
+        ImGui::Text("%.3f", r.ChurnMs);
+
+        ImGui::TableNextColumn();
+        ImGui::Text("%.3f", r.DrainMs);
+    }
+
+    ImGui::EndTable();
 }
 
 void PoolsDebugModule::RenderMenuEntry() {
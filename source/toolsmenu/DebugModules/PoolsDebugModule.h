@@ -10,5 +10,19 @@ public:
     NOTSA_IMPLEMENT_DEBUG_MODULE_SERIALIZATION(PoolsDebugModule, m_IsOpen);
 
 private:
-    bool m_IsOpen{};
+    void RenderBenchmark();
+    void RenderEventStats();
+
+private:
+    //! Result of a `CPool` allocation benchmark
+    struct BenchmarkResult {
+        float  Occupancy{};   //!< Target occupancy [0, 1]
+        bool   UseFreeList{}; //!< If the free-list was used
+        double FillMs{};      //!< Time it took to allocate up to `Occupancy` from an empty pool
+        double ChurnMs{};     //!< Time it took to delete and re-allocate random objects, in batches (while at `Occupancy`)
+        double DrainMs{};     //!< Time it took to delete all objects (in random order)
+    };
+
+    bool                         m_IsOpen{};
+    std::vector<BenchmarkResult> m_BenchmarkResults{};
 };
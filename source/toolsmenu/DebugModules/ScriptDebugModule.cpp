@@ -1,6 +1,9 @@
 #include <StdInc.h>
 #include "ScriptDebugModule.hpp"
 #include "TheScripts.h"
+#include "ScriptProfiler.h"
+#include "ScriptDecodeCache.h"
+#include "extensions/Configs/Scripts.hpp"
 
 namespace notsa { 
 namespace debugmodules {
@@ -11,6 +14,101 @@ void ScriptDebugModule::RenderWindow() {
     }
     using namespace ImGui;
     Checkbox("DbgFlag", &CTheScripts::DbgFlag);
+    RenderDecodeCache();
+    RenderProfiler();
+}
+
+void ScriptDebugModule::RenderDecodeCache() {
+    using namespace ImGui;
+    using notsa::script::DecodeCache;
+
+    if (!CollapsingHeader("Decode Cache")) {
+        return;
+    }
+    Checkbox("Enabled##DecodeCache", &g_ScriptsConfig.DecodeCache);
+    SameLine();
+    if (Button("Reset Stats##DecodeCache")) {
+        DecodeCache::ResetStats();
+    }
+    const auto& stats = DecodeCache::GetStats();
+    Text("Hits: %llu, Decoded: %llu", stats.NumHits, stats.NumMisses);
+}
+
+void ScriptDebugModule::RenderProfiler() {
+    using namespace ImGui;
+    using notsa::script::Profiler;
+
+    if (!CollapsingHeader("Profiler")) {
+        return;
+    }
+#ifndef NOTSA_WITH_SCRIPT_PROFILER
+    TextUnformatted("Compiled out (Build with `GTASA_WITH_SCRIPT_PROFILER`)");
+#else
+    if (bool enabled = Profiler::IsEnabled(); Checkbox("Enabled", &enabled)) {
+        Profiler::SetEnabled(enabled);
+    }
+    SameLine();
+    if (Button("Reset")) {
+        Profiler::Reset();
+    }
+    SameLine();
+    if (Button("Dump CSV")) {
+        Profiler::DumpCSV("script_profile.csv");
+    }
+    Text("Commands executed: %llu; Cycles: %llu", Profiler::GetTotalCalls(), Profiler::GetTotalCycles());
+
+    constexpr auto TABLE_FLAGS  = ImGuiTableFlags_Resizable | ImGuiTableFlags_BordersInnerH | ImGuiTableFlags_ScrollY;
+    const auto     RenderRow    = [](const char* name, const Profiler::Entry& e) {
+        TableNextRow();
+        TableNextColumn(); TextUnformatted(name);
+        TableNextColumn(); Text("%llu", e.Calls);
+        TableNextColumn(); Text("%llu", e.Cycles);
+        TableNextColumn(); Text("%llu", e.Calls ? e.Cycles / e.Calls : 0);
+        TableNextColumn(); Text("%.2f%%", Profiler::GetTotalCycles() ? (float)e.Cycles / (float)Profiler::GetTotalCycles() * 100.f : 0.f);
+    };
+    const auto     SetupColumns = [](const char* name) {
+        TableSetupColumn(name);
+        TableSetupColumn("Calls", ImGuiTableColumnFlags_WidthFixed);
+        TableSetupColumn("Cycles", ImGuiTableColumnFlags_WidthFixed);
+        TableSetupColumn("Cycles/Call", ImGuiTableColumnFlags_WidthFixed);
+        TableSetupColumn("% of Script Time", ImGuiTableColumnFlags_WidthFixed);
+        TableSetupScrollFreeze(0, 1);
+        TableHeadersRow();
+    };
+
+    // Scripts, hottest first
+    Separator();
+    TextUnformatted("Scripts");
+    if (BeginTable("Scripts", 5, TABLE_FLAGS, { 0.f, 200.f })) {
+        SetupColumns("Script");
+        auto scripts = Profiler::GetScripts() | rng::to<std::vector>();
+        rng::sort(scripts, std::greater{}, &Profiler::ScriptEntry::Cycles);
+        for (const auto& s : scripts) {
+            char name[std::size(s.Name) + 1]{};
+            std::memcpy(name, s.Name, std::size(s.Name));
+            RenderRow(name, s);
+        }
+        EndTable();
+    }
+
+    // Commands, hottest first
+    Separator();
+    TextUnformatted("Commands");
+    if (BeginTable("Commands", 5, TABLE_FLAGS, { 0.f, 300.f })) {
+        SetupColumns("Command");
+        std::vector<eScriptCommands> cmds;
+        for (auto id = 0u; id <= (size_t)COMMAND_HIGHEST_ID_TO_HOOK; id++) {
+            if (Profiler::GetCommand((eScriptCommands)id).Calls) {
+                cmds.push_back((eScriptCommands)id);
+            }
+        }
+        rng::sort(cmds, std::greater{}, [](eScriptCommands c) { return Profiler::GetCommand(c).Cycles; });
+        for (const auto cmd : cmds) {
+            RenderRow(std::string{ notsa::script::GetScriptCommandName(cmd) }.c_str(), Profiler::GetCommand(cmd));
+        }
+        EndTable();
+    }
+#endif
 }
 
 void ScriptDebugModule::RenderMenuEntry() {
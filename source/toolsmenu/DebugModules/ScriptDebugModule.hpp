@@ -12,6 +12,10 @@ public:
 
     NOTSA_IMPLEMENT_DEBUG_MODULE_SERIALIZATION(ScriptDebugModule, m_IsOpen);
 
+private:
+    void RenderDecodeCache();
+    void RenderProfiler();
+
 private:
     bool m_IsOpen{};
 };
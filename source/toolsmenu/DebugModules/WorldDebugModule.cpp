@@ -0,0 +1,186 @@
+#include "StdInc.h"
+
+#include "WorldDebugModule.h"
+
+#include "extensions/Configs/World.hpp"
+#include "LineOfSightBatch.h"
+
+void WorldDebugModule::RenderWindow() {
+    const notsa::ui::ScopedWindow window{ "World", {500.f, 300.f}, m_IsOpen };
+    if (!m_IsOpen) {
+        return;
+    }
+
+    RenderSpatialIndexStats();
+    RenderBenchmark();
+    RenderLineOfSightStats();
+    RenderCollisionIslandStats();
+    RenderPhysicalSleepStats();
+    RenderNeighbourGridStats();
+}
+
+void WorldDebugModule::RenderSpatialIndexStats() {
+    auto&       index = CWorld::ms_SpatialIndex;
+    const auto& stats = index.GetStats();
+
+    ImGui::Checkbox("Spatial index", &g_WorldConfig.SpatialIndex);
+    ImGui::SameLine();
+    if (ImGui::Button("Reset Stats##SpatialIndex")) {
+        index.ResetStats();
+    }
+    ImGui::SameLine();
+    if (ImGui::Button("Rebuild")) {
+        index.MarkAllDirty();
+    }
+
+    ImGui::Text("Lists queried: %llu, Rebuilt: %llu", stats.NumQueries, stats.NumRebuilds);
+    ImGui::Text(
+        "Entities tested: %llu, Dereferenced: %llu (%.1f%%)",
+        stats.NumTested,
+        stats.NumMatched,
+        stats.NumTested ? (double)(stats.NumMatched) / (double)(stats.NumTested) * 100.0 : 0.0
+    );
+}
+
+void WorldDebugModule::RenderBenchmark() {
+    if (!ImGui::CollapsingHeader("Query Benchmark")) {
+        return;
+    }
+
+    auto& index = CWorld::ms_SpatialIndex;
+
+    ImGui::SetNextItemWidth(150.f);
+    ImGui::InputInt("Queries to record", &m_NumQueriesToRecord);
+    m_NumQueriesToRecord = std::max(m_NumQueriesToRecord, 1);
+    if (index.IsRecording()) {
+        if (ImGui::Button("Stop")) {
+            index.StopRecording();
+        }
+    } else if (ImGui::Button("Record")) {
+        index.StartRecording((uint32)m_NumQueriesToRecord);
+        m_BenchmarkResult.reset();
+    }
+    ImGui::SameLine();
+    ImGui::Text("Recorded: %u%s", (uint32)index.GetRecording().size(), index.IsRecording() ? " (Recording...)" : "");
+
+    ImGui::SetNextItemWidth(150.f);
+    ImGui::InputInt("Repeats", &m_NumBenchmarkRepeats);
+    m_NumBenchmarkRepeats = std::max(m_NumBenchmarkRepeats, 1);
+    {
+        const notsa::ui::ScopedDisable disabled{ index.IsRecording() || index.GetRecording().empty() };
+        if (ImGui::Button("Run")) {
+            m_BenchmarkResult = index.RunBenchmark((uint32)m_NumBenchmarkRepeats);
+        }
+    }
+
+    if (!m_BenchmarkResult) {
+        return;
+    }
+    const auto& r = *m_BenchmarkResult;
+    ImGui::Text("%u queries x %u", r.NumQueries, r.NumRepeats);
+    ImGui::Text("Sector lists: %.3f ms", r.VanillaMs);
+    ImGui::Text("Spatial index: %.3f ms (%.2fx)", r.IndexMs, r.IndexMs > 0.0 ? r.VanillaMs / r.IndexMs : 0.0);
+    if (r.NumMismatches) {
+        ImGui::TextColored({ 1.f, 0.f, 0.f, 1.f }, "Results differ in %u queries!", r.NumMismatches);
+    } else {
+        ImGui::Text("Results match");
+    }
+}
+
+void WorldDebugModule::RenderLineOfSightStats() {
+    if (!ImGui::CollapsingHeader("Line of sight batches")) {
+        return;
+    }
+
+    const auto& stats = notsa::LineOfSightBatch::GetStats();
+    if (ImGui::Button("Reset Stats##LineOfSight")) {
+        notsa::LineOfSightBatch::ResetStats();
+    }
+    ImGui::Text("Rays: %llu, Hit: %llu", stats.NumRays, stats.NumHits);
+    ImGui::Text("Sectors walked: %llu, Entities visited: %llu", stats.NumSectors, stats.NumEntities);
+    ImGui::Text(
+        "Narrow tests: %llu (%.2f per ray)",
+        stats.NumNarrowTests,
+        stats.NumRays ? (double)(stats.NumNarrowTests) / (double)(stats.NumRays) : 0.0
+    );
+}
+
+void WorldDebugModule::RenderCollisionIslandStats() {
+    if (!ImGui::CollapsingHeader("Collision islands (Measurement only)")) {
+        return;
+    }
+
+    const auto& stats = CWorld::ms_CollisionIslands.GetStats();
+    ImGui::Checkbox("Build islands", &g_WorldConfig.CollisionIslands);
+    ImGui::Text("Moving entities: %u, Overlapping pairs: %u, Joined through non-moving entities: %u", stats.NumEntities, stats.NumPairs, stats.NumStillLinks);
+    ImGui::Text("Islands: %u (Single entity: %u), Largest: %u", stats.NumIslands, stats.NumSingles, stats.LargestIsland);
+    ImGui::Text(
+        "Speedup if processed in parallel (Upper bound): %.2fx",
+        stats.LargestIsland ? (double)(stats.NumEntities) / (double)(stats.LargestIsland) : 0.0
+    );
+}
+
+void WorldDebugModule::RenderPhysicalSleepStats() {
+    if (!ImGui::CollapsingHeader("Physical sleep")) {
+        return;
+    }
+
+    auto&       sleep = CWorld::ms_PhysicalSleep;
+    const auto& stats = sleep.GetStats();
+    ImGui::Checkbox("Put resting entities to sleep", &g_WorldConfig.PhysicalSleep);
+    ImGui::SameLine();
+    if (ImGui::Button("Reset Stats##PhysicalSleep")) {
+        sleep.ResetStats();
+    }
+    ImGui::SameLine();
+    if (ImGui::Button("Wake All")) {
+        sleep.WakeAll();
+    }
+
+    ImGui::SliderFloat("Max speed", &g_WorldConfig.PhysicalSleepMaxSpeed, 0.f, 0.02f, "%.4f");
+    ImGui::SliderFloat("Max turn speed", &g_WorldConfig.PhysicalSleepMaxTurnSpeed, 0.f, 0.02f, "%.4f");
+    ImGui::SliderFloat("Time to sleep [ms]", &g_WorldConfig.PhysicalSleepTime, 0.f, 10'000.f, "%.0f");
+
+    ImGui::Text("Awake: %u (Resting: %u), Sleeping: %u", stats.NumAwake, stats.NumResting, stats.NumSleeping);
+    ImGui::Text("Fell asleep: %llu, Woken up: %llu", stats.NumFellAsleep, stats.NumWokenUp);
+}
+
+void WorldDebugModule::RenderNeighbourGridStats() {
+    if (!ImGui::CollapsingHeader("Shared entity scanner")) {
+        return;
+    }
+
+#ifndef NOTSA_DEBUG
+    ImGui::TextUnformatted("Debug builds only (`CEntityScanner::ScanForEntitiesInRange` isn't reversed yet)");
+#else
+    auto&       grid  = CWorld::ms_NeighbourGrid;
+    const auto& stats = grid.GetStats();
+    ImGui::Checkbox("Scan all peds at once", &g_WorldConfig.SharedScanner);
+    ImGui::SameLine();
+    ImGui::Checkbox("In parallel", &g_WorldConfig.SharedScannerParallel);
+    ImGui::SameLine();
+    ImGui::Checkbox("Check against brute-force", &g_WorldConfig.SharedScannerVerify);
+    ImGui::SameLine();
+    if (ImGui::Button("Reset Stats##NeighbourGrid")) {
+        grid.ResetStats();
+    }
+
+    ImGui::SliderFloat("Range", &g_WorldConfig.SharedScannerRange, 1.f, 200.f, "%.0f");
+
+    ImGui::Text("Vehicles: %u, Peds: %u (Swept: %u)", stats.NumVehicles, stats.NumPeds, stats.NumSwept);
+    ImGui::Text(
+        "Builds: %llu, Scans served: %llu, Fell back: %llu (%.2f%%)",
+        stats.NumBuilds,
+        stats.NumHits,
+        stats.NumMisses,
+        stats.NumHits + stats.NumMisses ? 100.0 * (double)(stats.NumMisses) / (double)(stats.NumHits + stats.NumMisses) : 0.0
+    );
+    ImGui::Text("Sweeps checked against brute-force: %llu, Mismatching peds: %llu", stats.NumVerified, stats.NumMismatches);
+#endif
+}
+
+void WorldDebugModule::RenderMenuEntry() {
+    notsa::ui::DoNestedMenuIL({ "Stats" }, [&] {
+        ImGui::MenuItem("World", nullptr, &m_IsOpen);
+    });
+}
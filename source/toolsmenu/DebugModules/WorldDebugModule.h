@@ -0,0 +1,27 @@
+#pragma once
+
+#include "DebugModule.h"
+
+class WorldDebugModule final : public DebugModule {
+public:
+    void RenderWindow() override final;
+    void RenderMenuEntry() override final;
+
+    NOTSA_IMPLEMENT_DEBUG_MODULE_SERIALIZATION(WorldDebugModule, m_IsOpen, m_NumQueriesToRecord, m_NumBenchmarkRepeats);
+
+private:
+    void RenderSpatialIndexStats();
+    void RenderBenchmark();
+    void RenderLineOfSightStats();
+    void RenderCollisionIslandStats();
+    void RenderPhysicalSleepStats();
+    void RenderNeighbourGridStats();
+
+private:
+    bool m_IsOpen{};
+
+    // Query benchmark (See `notsa::WorldSpatialIndex::RunBenchmark`)
+    int32                                                   m_NumQueriesToRecord{ 10'000 };
+    int32                                                   m_NumBenchmarkRepeats{ 10 };
+    std::optional<notsa::WorldSpatialIndex::BenchmarkResult> m_BenchmarkResult{};
+};